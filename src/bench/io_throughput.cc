@@ -0,0 +1,37 @@
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include "../s21_matrix_oop.hpp"
+
+// Formats and parses a rows x cols matrix of random doubles in memory and
+// prints MB/s for each direction: ./throughput.out [rows] [cols]
+int main(int argc, char **argv) {
+  const int rows = (argc > 1) ? atoi(argv[1]) : 200000;
+  const int cols = (argc > 2) ? atoi(argv[2]) : 32;
+  S21::Matrix A(rows, cols);
+  srand(time(nullptr));
+  for (int i = 0; i < rows; ++i) {
+    for (int k = 0; k < cols; ++k) {
+      A(i, k) = (rand() - RAND_MAX / 2) / 1000.0;
+    }
+  }
+  std::stringstream stream;
+  auto start = std::chrono::steady_clock::now();
+  A.WriteMatrix(stream);
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  const std::string text = stream.str();
+  const double megabytes = text.size() / 1e6;
+  cout << "write\t" << megabytes / elapsed.count() << " MB/s" << endl;
+  const int threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int t = 1; t <= threads; t *= 2) {
+    std::istringstream in(text);
+    start = std::chrono::steady_clock::now();
+    S21::Matrix B = S21::Matrix::ReadMatrix(in, t);
+    elapsed = std::chrono::steady_clock::now() - start;
+    cout << "read x" << t << "\t" << megabytes / elapsed.count() << " MB/s"
+         << ((B == A) ? "" : "\tMISMATCH") << endl;
+  }
+  return 0;
+}
@@ -0,0 +1,33 @@
+#include <chrono>
+
+#include "../s21_matrix_oop.hpp"
+
+// Times MulMatrixShared on an n x n product for 1..processes workers and
+// prints the speedup over a single process: ./scaling.out [n] [processes]
+int main(int argc, char **argv) {
+  const int size = (argc > 1) ? atoi(argv[1]) : 512;
+  const int processes = (argc > 2) ? atoi(argv[2]) : 4;
+  S21::Matrix A(size, size), B(size, size);
+  srand(time(nullptr));
+  for (int i = 0; i < size; ++i) {
+    for (int k = 0; k < size; ++k) {
+      A(i, k) = rand() % 24;
+      B(i, k) = rand() % 24;
+    }
+  }
+  double single = 0;
+  cout << "processes\tseconds\tspeedup" << endl;
+  for (int p = 1; p <= processes; ++p) {
+    S21::Matrix C(A);
+    const auto start = std::chrono::steady_clock::now();
+    C.MulMatrixShared(B, p);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (p == 1) {
+      single = elapsed.count();
+    }
+    cout << p << "\t" << elapsed.count() << "\t" << single / elapsed.count()
+         << endl;
+  }
+  return 0;
+}
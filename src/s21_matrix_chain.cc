@@ -0,0 +1,214 @@
+#include "s21_matrix_oop.hpp"
+
+namespace S21 {
+MatrixChain::MatrixChain(const Matrix &left, const Matrix &right)
+    : factors_{&left, &right} {}
+
+const Matrix *MatrixChain::Keep(Matrix &&other) {
+  owned_.push_back(std::make_shared<const Matrix>(std::move(other)));
+  return owned_.back().get();
+}
+
+MatrixChain operator*(const Matrix &left, const Matrix &right) {
+  return MatrixChain(left, right);
+}
+
+MatrixChain operator*(const Matrix &left, Matrix &&right) {
+  MatrixChain chain;
+  chain.factors_.push_back(&left);
+  chain.factors_.push_back(chain.Keep(std::move(right)));
+  return chain;
+}
+
+MatrixChain operator*(Matrix &&left, const Matrix &right) {
+  MatrixChain chain;
+  chain.factors_.push_back(chain.Keep(std::move(left)));
+  chain.factors_.push_back(&right);
+  return chain;
+}
+
+MatrixChain operator*(Matrix &&left, Matrix &&right) {
+  MatrixChain chain;
+  chain.factors_.push_back(chain.Keep(std::move(left)));
+  chain.factors_.push_back(chain.Keep(std::move(right)));
+  return chain;
+}
+
+int MatrixChain::GetLength() const { return factors_.size(); }
+
+long long MatrixChain::GetCost() const {
+  std::vector<int> split;
+  return ChainOrder(split);
+}
+
+MatrixChain MatrixChain::operator*(const Matrix &other) const {
+  MatrixChain chain(*this);
+  chain.factors_.push_back(&other);
+  return chain;
+}
+
+MatrixChain MatrixChain::operator*(Matrix &&other) const {
+  MatrixChain chain(*this);
+  chain.factors_.push_back(chain.Keep(std::move(other)));
+  return chain;
+}
+
+MatrixChain MatrixChain::operator*(const MatrixChain &other) const {
+  MatrixChain chain(*this);
+  chain.factors_.insert(chain.factors_.end(), other.factors_.begin(),
+                        other.factors_.end());
+  chain.owned_.insert(chain.owned_.end(), other.owned_.begin(),
+                      other.owned_.end());
+  return chain;
+}
+
+MatrixChain operator*(const Matrix &other, const MatrixChain &chain) {
+  MatrixChain newChain(chain);
+  newChain.factors_.insert(newChain.factors_.begin(), &other);
+  return newChain;
+}
+
+MatrixChain operator*(Matrix &&other, const MatrixChain &chain) {
+  MatrixChain newChain(chain);
+  newChain.factors_.insert(newChain.factors_.begin(),
+                           newChain.Keep(std::move(other)));
+  return newChain;
+}
+
+MatrixChain::operator Matrix() const { return Evaluate(); }
+
+int MatrixChain::GetRows() const { return factors_.front()->rows_; }
+
+int MatrixChain::GetCols() const { return factors_.back()->cols_; }
+
+Matrix MatrixChain::operator+(const Matrix &other) const {
+  return Evaluate() + other;
+}
+
+Matrix MatrixChain::operator-(const Matrix &other) const {
+  return Evaluate() - other;
+}
+
+Matrix operator*(const MatrixChain &chain, const double &num) {
+  return chain.Evaluate() * num;
+}
+
+Matrix operator*(const double &num, const MatrixChain &chain) {
+  return num * chain.Evaluate();
+}
+
+bool MatrixChain::operator==(const Matrix &other) const {
+  return Evaluate() == other;
+}
+
+double MatrixChain::operator()(const int &i, const int &j) const {
+  return Evaluate()(i, j);
+}
+
+bool MatrixChain::EqMatrix(const Matrix &other) const {
+  return Evaluate().EqMatrix(other);
+}
+
+Matrix MatrixChain::Transpose() const { return Evaluate().Transpose(); }
+
+double MatrixChain::Determinant() const { return Evaluate().Determinant(); }
+
+Matrix MatrixChain::CalcComplements() const {
+  return Evaluate().CalcComplements();
+}
+
+Matrix MatrixChain::InverseMatrix() const {
+  return Evaluate().InverseMatrix();
+}
+
+Matrix MatrixChain::Solve(const Matrix &B) const {
+  return Evaluate().Solve(B);
+}
+
+Matrix MatrixChain::Power(const int &power) const {
+  return Evaluate().Power(power);
+}
+
+Matrix MatrixChain::Exp() const { return Evaluate().Exp(); }
+
+void MatrixChain::WriteMatrix(std::ostream &out, const char &delimiter) const {
+  Evaluate().WriteMatrix(out, delimiter);
+}
+
+void MatrixChain::SaveMatrix(const std::string &path,
+                             const char &delimiter) const {
+  Evaluate().SaveMatrix(path, delimiter);
+}
+
+// Two factors go straight to the kernel, without the scratch or the copy
+// MulMatrix would make
+Matrix MatrixChain::Evaluate() const {
+  Matrix res;
+  std::vector<int> split;
+  ChainOrder(split);
+  const int length = factors_.size();
+  if (length == 2) {
+    Matrix::MulKernel(*factors_[0], *factors_[1], res);
+    return res;
+  }
+  std::vector<Matrix> scratch(2 * length);
+  ChainMul(split, 0, length - 1, 0, scratch, res);
+  return res;
+}
+
+// Classic O(k^3) dynamic program: cost[i][j] is the cheapest way to multiply
+// factors i..j, split[i * k + j] the factor after which it is parenthesized
+long long MatrixChain::ChainOrder(std::vector<int> &split) const {
+  const int length = factors_.size();
+  std::vector<long long> dims(length + 1);
+  for (int i = 0; i < length; ++i) {
+    if (i > 0 && factors_[i - 1]->cols_ != factors_[i]->rows_) {
+      throw std::out_of_range(
+          "Columns of matrix_1 not equal to Rows of matrix_2");
+    }
+    if (factors_[i]->rows_ <= 0 || factors_[i]->cols_ <= 0) {
+      throw std::invalid_argument(
+          "Some columns or some rows equal or less to zero");
+    }
+    dims[i] = factors_[i]->rows_;
+  }
+  dims[length] = factors_[length - 1]->cols_;
+  std::vector<long long> cost(length * length, 0);
+  split.assign(length * length, 0);
+  for (int span = 1; span < length; ++span) {
+    for (int i = 0; i + span < length; ++i) {
+      const int j = i + span;
+      cost[i * length + j] = -1;
+      for (int s = i; s < j; ++s) {
+        const long long c = cost[i * length + s] + cost[(s + 1) * length + j] +
+                            dims[i] * dims[s + 1] * dims[j + 1];
+        if (cost[i * length + j] < 0 || c < cost[i * length + j]) {
+          cost[i * length + j] = c;
+          split[i * length + j] = s;
+        }
+      }
+    }
+  }
+  return cost[length - 1];
+}
+
+// Subproducts at recursion depth d land in scratch[2d] and scratch[2d + 1];
+// deeper levels only reuse those slots once their result has been consumed
+void MatrixChain::ChainMul(const std::vector<int> &split, const int &i,
+                           const int &j, const int &depth,
+                           std::vector<Matrix> &scratch, Matrix &res) const {
+  const int length = factors_.size();
+  const int s = split[i * length + j];
+  const Matrix *left = factors_[i];
+  const Matrix *right = factors_[j];
+  if (s > i) {
+    ChainMul(split, i, s, depth + 1, scratch, scratch[2 * depth]);
+    left = &scratch[2 * depth];
+  }
+  if (s + 1 < j) {
+    ChainMul(split, s + 1, j, depth + 1, scratch, scratch[2 * depth + 1]);
+    right = &scratch[2 * depth + 1];
+  }
+  Matrix::MulKernel(*left, *right, res);
+}
+}  // namespace S21
\ No newline at end of file
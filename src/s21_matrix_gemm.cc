@@ -0,0 +1,77 @@
+#include "s21_matrix_oop.hpp"
+
+namespace S21 {
+void Gemm(const double &alpha, const Matrix &A, const bool &transA,
+          const Matrix &B, const bool &transB, const double &beta,
+          Matrix &C) {
+  if (&C == &A || &C == &B) {
+    throw std::invalid_argument("Result matrix aliases an operand");
+  }
+  const int rows = transA ? A.cols_ : A.rows_;
+  const int inner = transA ? A.rows_ : A.cols_;
+  const int cols = transB ? B.rows_ : B.cols_;
+  if (inner != (transB ? B.cols_ : B.rows_)) {
+    throw std::out_of_range(
+        "Columns of matrix_1 not equal to Rows of matrix_2");
+  }
+  if (C.rows_ != rows || C.cols_ != cols) {
+    if (beta != 0) {
+      throw std::out_of_range("Matrix parameters are not equal to each other");
+    }
+    C.ResizeMatrix(rows, cols);
+  }
+  Matrix::GemmKernel(alpha, A, transA, B, transB, beta, C, inner);
+}
+
+void Gemv(const double &alpha, const Matrix &A, const bool &transA,
+          const Matrix &x, const double &beta, Matrix &y) {
+  if (&y == &A || &y == &x) {
+    throw std::invalid_argument("Result matrix aliases an operand");
+  }
+  const int rows = transA ? A.cols_ : A.rows_;
+  const int inner = transA ? A.rows_ : A.cols_;
+  if (x.cols_ != 1 || x.rows_ != inner) {
+    throw std::out_of_range("Vector size not equal to Columns of matrix");
+  }
+  if (y.rows_ != rows || y.cols_ != 1) {
+    if (beta != 0) {
+      throw std::out_of_range("Matrix parameters are not equal to each other");
+    }
+    y.ResizeMatrix(rows, 1);
+  }
+  for (int m = 0; m < rows; ++m) {
+    y.matrix_[m][0] = (beta == 0) ? 0 : y.matrix_[m][0] * beta;
+  }
+  if (!transA) {
+    for (int m = 0; m < rows; ++m) {
+      const double *row = A.matrix_[m];
+      double dot = 0;
+      for (int k = 0; k < inner; ++k) {
+        dot += row[k] * x.matrix_[k][0];
+      }
+      y.matrix_[m][0] += alpha * dot;
+    }
+  } else {
+    for (int k = 0; k < inner; ++k) {
+      const double *row = A.matrix_[k];
+      const double a = alpha * x.matrix_[k][0];
+      for (int m = 0; m < rows; ++m) {
+        y.matrix_[m][0] += a * row[m];
+      }
+    }
+  }
+}
+
+void Axpy(const double &alpha, const Matrix &X, Matrix &Y) {
+  if (!Y.SizeCompare(X)) {
+    throw std::out_of_range("Matrix parameters are not equal to each other");
+  }
+  for (int i = 0; i < Y.rows_; ++i) {
+    double *row = Y.matrix_[i];
+    const double *other = X.matrix_[i];
+    for (int k = 0; k < Y.cols_; ++k) {
+      row[k] += alpha * other[k];
+    }
+  }
+}
+}  // namespace S21
\ No newline at end of file
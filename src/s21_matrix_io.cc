@@ -0,0 +1,196 @@
+#include <charconv>
+#include <climits>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include "s21_matrix_oop.hpp"
+
+namespace S21 {
+namespace {
+const size_t kChunkSize = 1 << 22;
+const size_t kLinesPerThread = 4096;
+
+typedef std::vector<std::pair<const char *, const char *>> Lines;
+
+bool IsSeparator(const char &c) {
+  return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+}
+
+// Parses the fields of [begin, end) into row and returns how many there are,
+// cols + 1 as soon as there are too many and -1 on a malformed number. With
+// row == nullptr the fields are only counted
+int ParseLine(const char *begin, const char *end, double *row,
+              const int &cols) {
+  int count = 0;
+  for (const char *p = begin;; ++count) {
+    while (p != end && IsSeparator(*p)) {
+      ++p;
+    }
+    if (p == end) {
+      break;
+    }
+    if (count == cols) {
+      return cols + 1;
+    }
+    if (*p == '+' && ++p != end && *p == '-') {
+      return -1;
+    }
+    double value = 0;
+    const auto [next, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc() || (next != end && !IsSeparator(*next))) {
+      return -1;
+    }
+    if (row) {
+      row[count] = value;
+    }
+    p = next;
+  }
+  return count;
+}
+
+void CheckDelimiter(const char &delimiter) {
+  if (delimiter == '\r' || !IsSeparator(delimiter)) {
+    throw std::invalid_argument("Delimiter is not a separator");
+  }
+}
+
+void SplitLines(const char *begin, const char *end, Lines &lines) {
+  lines.clear();
+  while (begin != end) {
+    const char *next = std::find(begin, end, '\n');
+    if (std::find_if_not(begin, next, IsSeparator) != next) {
+      lines.emplace_back(begin, next);
+    }
+    begin = (next == end) ? end : next + 1;
+  }
+}
+
+// Rows for the whole chunk are added up front, so every thread parses its
+// share of lines straight into the matrix rows
+void ParseLines(Matrix &res, const Lines &lines, const int &threads,
+                int &cols) {
+  if (lines.empty()) {
+    return;
+  }
+  if (cols < 0) {
+    cols = ParseLine(lines[0].first, lines[0].second, nullptr, INT_MAX);
+    if (cols < 0) {
+      throw std::invalid_argument("Malformed matrix row 1");
+    }
+    res.SetCols(cols);
+  }
+  const int base = res.GetRows();
+  const int count = lines.size();
+  res.SetRows(base + count);
+  double **rows = res.GetMatrix();
+  const int workers = std::max<int>(
+      1, std::min<size_t>(threads, lines.size() / kLinesPerThread));
+  std::vector<int> bad(workers, count);
+  auto parse = [&](const int &worker) {
+    const int from = count * worker / workers;
+    const int to = count * (worker + 1) / workers;
+    for (int i = from; i < to; ++i) {
+      if (ParseLine(lines[i].first, lines[i].second, rows[base + i], cols) !=
+          cols) {
+        bad[worker] = i;
+        return;
+      }
+    }
+  };
+  std::vector<std::thread> pool;
+  for (int worker = 1; worker < workers; ++worker) {
+    pool.emplace_back(parse, worker);
+  }
+  parse(0);
+  for (std::thread &thread : pool) {
+    thread.join();
+  }
+  const int first = *std::min_element(bad.begin(), bad.end());
+  if (first != count) {
+    throw std::invalid_argument("Malformed matrix row " +
+                                std::to_string(base + first + 1));
+  }
+}
+}  // namespace
+
+// Reads rows of numbers separated by spaces, tabs, commas or semicolons, one
+// row per line, blank lines skipped. Input is consumed in fixed-size chunks,
+// the unfinished last line of a chunk is carried over into the next one
+Matrix Matrix::ReadMatrix(std::istream &in, const int &threads) {
+  if (threads <= 0) {
+    throw std::invalid_argument("Threads less or equal to zero");
+  }
+  Matrix res;
+  std::vector<char> buffer;
+  Lines lines;
+  size_t carry = 0;
+  int cols = -1;
+  bool last = false;
+  while (!last) {
+    buffer.resize(carry + kChunkSize);
+    in.read(buffer.data() + carry, kChunkSize);
+    const size_t size = carry + in.gcount();
+    last = !in;
+    const char *begin = buffer.data();
+    const char *stop = begin + size;
+    if (!last) {
+      while (stop != begin && stop[-1] != '\n') {
+        --stop;
+      }
+    }
+    SplitLines(begin, stop, lines);
+    ParseLines(res, lines, threads, cols);
+    carry = begin + size - stop;
+    if (stop != begin) {
+      std::copy(stop, stop + carry, buffer.data());
+    }
+  }
+  if (in.bad()) {
+    throw std::runtime_error("Can not read matrix");
+  }
+  return res;
+}
+
+Matrix Matrix::LoadMatrix(const std::string &path, const int &threads) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Can not open file");
+  }
+  return ReadMatrix(file, threads);
+}
+
+// Shortest round-trip form of every element, buffered into chunks. Only the
+// separators ReadMatrix accepts may be used as the delimiter
+void Matrix::WriteMatrix(std::ostream &out, const char &delimiter) const {
+  CheckDelimiter(delimiter);
+  std::string buffer;
+  buffer.reserve(kChunkSize + 32);
+  char number[32];
+  for (int i = 0; i < rows_; ++i) {
+    for (int k = 0; k < cols_; ++k) {
+      const auto [end, ec] =
+          std::to_chars(number, number + sizeof(number), matrix_[i][k]);
+      buffer.append(number, end);
+      buffer.push_back((k + 1 < cols_) ? delimiter : '\n');
+      if (buffer.size() >= kChunkSize) {
+        out.write(buffer.data(), buffer.size());
+        buffer.clear();
+      }
+    }
+  }
+  out.write(buffer.data(), buffer.size());
+  if (!out) {
+    throw std::runtime_error("Can not write matrix");
+  }
+}
+
+void Matrix::SaveMatrix(const std::string &path, const char &delimiter) const {
+  CheckDelimiter(delimiter);
+  std::ofstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Can not open file");
+  }
+  WriteMatrix(file, delimiter);
+}
+}  // namespace S21
\ No newline at end of file
@@ -1,20 +1,47 @@
 #include "s21_matrix_oop.hpp"
 
 namespace S21 {
-Matrix::Matrix() noexcept : rows_{0}, cols_{0}, matrix_{nullptr} {};
+Matrix::Matrix() noexcept
+    : rows_{0},
+      cols_{0},
+      rowsCap_{0},
+      colsCap_{0},
+      matrix_{nullptr},
+      shm_{nullptr},
+      shmSize_{0} {};
 
 Matrix::Matrix(const int &newRow, const int &newCol)
-    : rows_{newRow}, cols_{newCol} {
+    : rows_{newRow},
+      cols_{newCol},
+      rowsCap_{0},
+      colsCap_{0},
+      shm_{nullptr},
+      shmSize_{0} {
   InitializeMatrix();
 }
 
 Matrix::Matrix(const Matrix &other) noexcept
-    : rows_{0}, cols_{0}, matrix_{nullptr} {
+    : rows_{0},
+      cols_{0},
+      rowsCap_{0},
+      colsCap_{0},
+      matrix_{nullptr},
+      shm_{nullptr},
+      shmSize_{0} {
   CopyMatrix(other);
 }
 
-Matrix::Matrix(Matrix &&other) noexcept : rows_{0}, cols_{0}, matrix_{nullptr} {
-  CopyMatrix(other);
+// Takes over the buffer, which also keeps a shared matrix shared
+Matrix::Matrix(Matrix &&other) noexcept
+    : rows_{other.rows_},
+      cols_{other.cols_},
+      rowsCap_{other.rowsCap_},
+      colsCap_{other.colsCap_},
+      matrix_{other.matrix_},
+      shm_{other.shm_},
+      shmSize_{other.shmSize_} {
+  other.matrix_ = nullptr;
+  other.shm_ = nullptr;
   other.DeleteMatrix();
 }
 
@@ -26,34 +53,22 @@ int Matrix::GetCols() const { return cols_; }
 
 double **Matrix::GetMatrix() const { return matrix_; }
 
+int Matrix::GetRowsCapacity() const { return rowsCap_; }
+
+int Matrix::GetColsCapacity() const { return colsCap_; }
+
 void Matrix::SetRows(const int &newRows) {
   if (newRows < 0) {
     throw std::invalid_argument("Rows is less than zero");
   }
-  Matrix newMatrix(newRows, cols_);
-  for (int i = 0; i < newRows && i < rows_; ++i) {
-    for (int k = 0; k < cols_; ++k) {
-      newMatrix(i, k) = matrix_[i][k];
-    }
-  }
-  DeleteMatrix();
-  rows_ = newRows;
-  *this = newMatrix;
+  ResizeMatrix(newRows, cols_);
 }
 
 void Matrix::SetCols(const int &newCols) {
   if (newCols < 0) {
     throw std::invalid_argument("Columns is less than zero");
   }
-  Matrix newMatrix(rows_, newCols);
-  for (int i = 0; i < rows_; ++i) {
-    for (int k = 0; k < cols_ && k < newCols; ++k) {
-      newMatrix(i, k) = matrix_[i][k];
-    }
-  }
-  DeleteMatrix();
-  rows_ = newCols;
-  *this = newMatrix;
+  ResizeMatrix(rows_, newCols);
 }
 
 void Matrix::SetMatrix(double **newMatrix, const int &row, const int &col) {
@@ -70,6 +85,94 @@ void Matrix::SetMatrix(double **newMatrix, const int &row, const int &col) {
   }
 }
 
+void Matrix::Reserve(const int &rows, const int &cols) {
+  if (rows < 0 || cols < 0) {
+    throw std::invalid_argument("Capacity is less than zero");
+  }
+  if (cols > colsCap_) {
+    GrowColsCapacity(cols);
+  }
+  if (rows > rowsCap_) {
+    GrowRowsCapacity(rows);
+  }
+}
+
+void Matrix::ShrinkToFit() {
+  if ((rows_ == rowsCap_ && cols_ == colsCap_) || shm_) {
+    return;
+  }
+  if (rows_ == 0 && cols_ == 0) {
+    DeleteMatrix();
+    return;
+  }
+  double **newMatrix = new double *[rows_];
+  for (int i = 0; i < rows_; ++i) {
+    newMatrix[i] = new double[cols_];
+    for (int k = 0; k < cols_; ++k) {
+      newMatrix[i][k] = matrix_[i][k];
+    }
+  }
+  const int rows = rows_, cols = cols_;
+  DeleteMatrix();
+  matrix_ = newMatrix;
+  rows_ = rowsCap_ = rows;
+  cols_ = colsCap_ = cols;
+}
+
+void Matrix::AppendRow(const double *row) {
+  if (cols_ == 0) {
+    throw std::invalid_argument("Columns is equal to zero");
+  }
+  if (rows_ == rowsCap_) {
+    GrowRowsCapacity(rowsCap_ > 0 ? rowsCap_ * 2 : 1);
+  }
+  for (int k = 0; k < cols_; ++k) {
+    matrix_[rows_][k] = row[k];
+  }
+  ++rows_;
+}
+
+void Matrix::AppendRows(double **rows, const int &count) {
+  if (count < 0) {
+    throw std::invalid_argument("Rows is less than zero");
+  }
+  if (rows_ + count > rowsCap_) {
+    Reserve(std::max(rows_ + count, rowsCap_ * 2), colsCap_);
+  }
+  for (int i = 0; i < count; ++i) {
+    AppendRow(rows[i]);
+  }
+}
+
+void Matrix::AppendRows(const Matrix &other) {
+  if (rows_ == 0 && cols_ == 0) {
+    SetCols(other.cols_);
+  }
+  if (cols_ != other.cols_) {
+    throw std::out_of_range(
+        "Columns of matrix_1 not equal to Columns of matrix_2");
+  }
+  if (&other == this) {
+    Matrix copy(other);
+    AppendRows(copy.matrix_, copy.rows_);
+  } else {
+    AppendRows(other.matrix_, other.rows_);
+  }
+}
+
+void Matrix::AppendCol(const double *col) {
+  if (rows_ == 0) {
+    throw std::invalid_argument("Rows is equal to zero");
+  }
+  if (cols_ == colsCap_) {
+    GrowColsCapacity(colsCap_ > 0 ? colsCap_ * 2 : 1);
+  }
+  for (int i = 0; i < rows_; ++i) {
+    matrix_[i][cols_] = col[i];
+  }
+  ++cols_;
+}
+
 Matrix Matrix::operator+(const Matrix &other) const {
   Matrix sum(*this);
   sum.SumMatrix(other);
@@ -82,12 +185,6 @@ Matrix Matrix::operator-(const Matrix &other) const {
   return sub;
 }
 
-Matrix Matrix::operator*(const Matrix &other) const {
-  Matrix mulM(*this);
-  mulM.MulMatrix(other);
-  return mulM;
-}
-
 Matrix operator*(const Matrix &other, const double &num) {
   Matrix mulN(other);
   mulN.MulNumber(num);
@@ -166,21 +263,15 @@ void Matrix::MulNumber(const double &num) {
 
 void Matrix::MulMatrix(const Matrix &other) {
   if (cols_ != other.rows_) {
-    std::out_of_range("Columns of matrix_1 not equal to Rows of matrix_2");
+    throw std::out_of_range(
+        "Columns of matrix_1 not equal to Rows of matrix_2");
   }
   if (cols_ <= 0 || other.cols_ <= 0 || rows_ <= 0 || other.rows_ <= 0) {
     throw std::invalid_argument(
         "Some columns or some rows equal or less to zero");
   }
-  Matrix newMatrix(rows_, other.cols_);
-  for (int m = 0; m < rows_; ++m) {
-    for (int n = 0; n < other.cols_; ++n) {
-      for (int k = 0; k < other.rows_; ++k) {
-        newMatrix.matrix_[m][n] += matrix_[m][k] * other.matrix_[k][n];
-      }
-    }
-  }
-  DeleteMatrix();
+  Matrix newMatrix;
+  MulKernel(*this, other, newMatrix);
   *this = newMatrix;
 }
 
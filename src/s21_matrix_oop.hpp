@@ -1,15 +1,24 @@
 #ifndef S21_MATRIX_OOP_H_
 #define S21_MATRIX_OOP_H_
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 using namespace std;
 namespace S21 {
+class MatrixChain;
+
 class Matrix {
  private:
   int rows_, cols_;
+  int rowsCap_, colsCap_;
   double **matrix_;
+  double *shm_;
+  size_t shmSize_;
 
  protected:
   bool SizeCompare(const Matrix &) const;
@@ -18,10 +27,25 @@ class Matrix {
   void PlusMinus(const Matrix &, const int &);
   void CutMatrix(Matrix &, const int &, const int &, Matrix &);
   void CopyMatrix(const Matrix &);
+  void GrowRowsCapacity(const int &);
+  void GrowColsCapacity(const int &);
+  void ResizeMatrix(const int &, const int &);
+  static void MulKernel(const Matrix &, const Matrix &, Matrix &);
+  static void GemmKernel(const double &, const Matrix &, const bool &,
+                         const Matrix &, const bool &, const double &,
+                         Matrix &, const int &);
+
+  friend class MatrixChain;
+  friend void Gemm(const double &, const Matrix &, const bool &,
+                   const Matrix &, const bool &, const double &, Matrix &);
+  friend void Gemv(const double &, const Matrix &, const bool &,
+                   const Matrix &, const double &, Matrix &);
+  friend void Axpy(const double &, const Matrix &, Matrix &);
 
  public:
   Matrix() noexcept;
   Matrix(const int &, const int &);
+  Matrix(const int &, const int &, const std::string &);
   Matrix(const Matrix &) noexcept;
   Matrix(Matrix &&) noexcept;
   ~Matrix();
@@ -29,14 +53,24 @@ class Matrix {
   int GetRows() const;
   int GetCols() const;
   double **GetMatrix() const;
+  int GetRowsCapacity() const;
+  int GetColsCapacity() const;
+  bool IsShared() const;
+  static void UnlinkShared(const std::string &);
 
   void SetRows(const int &);
   void SetCols(const int &);
   void SetMatrix(double **, const int &, const int &);
 
+  void Reserve(const int &, const int &);
+  void ShrinkToFit();
+  void AppendRow(const double *);
+  void AppendRows(double **, const int &);
+  void AppendRows(const Matrix &);
+  void AppendCol(const double *);
+
   Matrix operator+(const Matrix &) const;
   Matrix operator-(const Matrix &) const;
-  Matrix operator*(const Matrix &) const;
   friend Matrix operator*(const Matrix &, const double &);
   friend Matrix operator*(const double &, const Matrix &);
   Matrix &operator+=(const Matrix &);
@@ -44,6 +78,7 @@ class Matrix {
   Matrix &operator*=(const Matrix &);
   Matrix &operator*=(const double &);
   Matrix &operator=(const Matrix &);
+  void Swap(Matrix &) noexcept;
   bool operator==(const Matrix &) const;
   double &operator()(const int &, const int &) const;
 
@@ -52,13 +87,107 @@ class Matrix {
   void SubMatrix(const Matrix &);
   void MulNumber(const double &);
   void MulMatrix(const Matrix &);
+  // Tiled product shared with other processes. With a process count the
+  // workers are forked children and the number that took part is returned;
+  // with a name any process may join through MulMatrixWorker(name) while
+  // the caller computes, and the caller waits for the tiles they took
+  int MulMatrixShared(const Matrix &, const int &, const int &tile = 64);
+  void MulMatrixShared(const Matrix &, const std::string &,
+                       const int &tile = 64);
+  static int MulMatrixWorker(const std::string &);
+
+  static Matrix ReadMatrix(std::istream &, const int &threads = 1);
+  static Matrix LoadMatrix(const std::string &, const int &threads = 1);
+  void WriteMatrix(std::ostream &, const char &delimiter = ',') const;
+  void SaveMatrix(const std::string &, const char &delimiter = ',') const;
   Matrix Transpose();
   double Determinant();
   Matrix CalcComplements();
   Matrix InverseMatrix();
+  Matrix Solve(const Matrix &) const;
+  Matrix Solve(const Matrix &, double &) const;
+  Matrix Power(const int &) const;
+  Matrix Exp() const;
 };
 Matrix operator*(const Matrix &, const double &);
 Matrix operator*(const double &, const Matrix &);
+MatrixChain operator*(const Matrix &, const Matrix &);
+MatrixChain operator*(const Matrix &, Matrix &&);
+MatrixChain operator*(Matrix &&, const Matrix &);
+MatrixChain operator*(Matrix &&, Matrix &&);
+
+// In-place BLAS-style updates, the destination must not alias an operand:
+// C = alpha * op(A) * op(B) + beta * C, where op(X) is X or X^T
+void Gemm(const double &, const Matrix &, const bool &, const Matrix &,
+          const bool &, const double &, Matrix &);
+// y = alpha * op(A) * x + beta * y for column matrices x and y
+void Gemv(const double &, const Matrix &, const bool &, const Matrix &,
+          const double &, Matrix &);
+// Y = alpha * X + Y
+void Axpy(const double &, const Matrix &, Matrix &);
+
+// Product A * B * ... kept unevaluated until it is converted to a Matrix,
+// then multiplied in the order with the fewest scalar multiplications.
+// Temporary factors are moved into the chain and kept alive by it, named
+// ones are referenced: the chain must not outlive those, and a change to a
+// named factor before evaluation shows up in the result
+class MatrixChain {
+ private:
+  std::vector<const Matrix *> factors_;
+  std::vector<std::shared_ptr<const Matrix>> owned_;
+
+ protected:
+  MatrixChain() = default;
+  const Matrix *Keep(Matrix &&);
+
+  long long ChainOrder(std::vector<int> &) const;
+  void ChainMul(const std::vector<int> &, const int &, const int &,
+                const int &, std::vector<Matrix> &, Matrix &) const;
+
+ public:
+  MatrixChain(const Matrix &, const Matrix &);
+
+  int GetLength() const;
+  long long GetCost() const;
+
+  MatrixChain operator*(const Matrix &) const;
+  MatrixChain operator*(Matrix &&) const;
+  MatrixChain operator*(const MatrixChain &) const;
+  friend MatrixChain operator*(const Matrix &, const Matrix &);
+  friend MatrixChain operator*(const Matrix &, Matrix &&);
+  friend MatrixChain operator*(Matrix &&, const Matrix &);
+  friend MatrixChain operator*(Matrix &&, Matrix &&);
+  friend MatrixChain operator*(const Matrix &, const MatrixChain &);
+  friend MatrixChain operator*(Matrix &&, const MatrixChain &);
+  operator Matrix() const;
+
+  // Sizes come from the factors, everything else evaluates the product
+  // first, as the same expression on a Matrix did
+  int GetRows() const;
+  int GetCols() const;
+  Matrix operator+(const Matrix &) const;
+  Matrix operator-(const Matrix &) const;
+  friend Matrix operator*(const MatrixChain &, const double &);
+  friend Matrix operator*(const double &, const MatrixChain &);
+  bool operator==(const Matrix &) const;
+  double operator()(const int &, const int &) const;
+  bool EqMatrix(const Matrix &) const;
+  Matrix Transpose() const;
+  double Determinant() const;
+  Matrix CalcComplements() const;
+  Matrix InverseMatrix() const;
+  Matrix Solve(const Matrix &) const;
+  Matrix Power(const int &) const;
+  Matrix Exp() const;
+  void WriteMatrix(std::ostream &, const char &delimiter = ',') const;
+  void SaveMatrix(const std::string &, const char &delimiter = ',') const;
+
+  Matrix Evaluate() const;
+};
+MatrixChain operator*(const Matrix &, const MatrixChain &);
+MatrixChain operator*(Matrix &&, const MatrixChain &);
+Matrix operator*(const MatrixChain &, const double &);
+Matrix operator*(const double &, const MatrixChain &);
 }  // namespace S21
 
 #endif  //  S21_MATRIX_OOP_H_
@@ -0,0 +1,216 @@
+#include <cfloat>
+
+#include "s21_matrix_oop.hpp"
+
+namespace S21 {
+namespace {
+// Pade approximant degrees with the 1-norm bounds up to which each of them is
+// accurate to double precision and their coefficients, Higham (2005)
+const int kDegrees[] = {3, 5, 7, 9, 13};
+const double kTheta[] = {1.495585217958292e-2, 2.539398330063230e-1,
+                         9.504178996162932e-1, 2.097847961257068,
+                         5.371920351148152};
+const double kPade3[] = {120, 60, 12, 1};
+const double kPade5[] = {30240, 15120, 3360, 420, 30, 1};
+const double kPade7[] = {17297280, 8648640, 1995840, 277200,
+                         25200,    1512,    56,      1};
+const double kPade9[] = {17643225600, 8821612800, 2075673600, 302702400,
+                         30270240,    2162160,    110880,     3960,
+                         90,          1};
+const double kPade13[] = {64764752532480000.0,
+                          32382376266240000.0,
+                          7771770303897600.0,
+                          1187353796428800.0,
+                          129060195264000.0,
+                          10559470521600.0,
+                          670442572800.0,
+                          33522128640.0,
+                          1323241920.0,
+                          40840800.0,
+                          960960.0,
+                          16380.0,
+                          182.0,
+                          1.0};
+
+Matrix ScaledIdentity(const int &size, const double &num) {
+  Matrix res(size, size);
+  for (int i = 0; i < size; ++i) {
+    res(i, i) = num;
+  }
+  return res;
+}
+}  // namespace
+
+Matrix Matrix::Solve(const Matrix &B) const {
+  double det = 0;
+  return Solve(B, det);
+}
+
+// LU with partial pivoting applied to B alongside, then back substitution.
+// Pivoting swaps row pointers of the working copies only. A pivot at or below
+// size * epsilon of the infinity norm means the matrix is singular; the
+// determinant is the signed product of the pivots
+Matrix Matrix::Solve(const Matrix &B, double &det) const {
+  if (rows_ != cols_ || rows_ == 0) {
+    throw std::out_of_range("Matrix is not square");
+  }
+  if (B.rows_ != rows_) {
+    throw std::out_of_range(
+        "Columns of matrix_1 not equal to Rows of matrix_2");
+  }
+  Matrix lu(*this);
+  Matrix res(B);
+  double **a = lu.matrix_;
+  double **x = res.matrix_;
+  double norm = 0;
+  for (int r = 0; r < rows_; ++r) {
+    double sum = 0;
+    for (int k = 0; k < cols_; ++k) {
+      sum += fabs(a[r][k]);
+    }
+    norm = std::max(norm, sum);
+  }
+  const double tolerance = rows_ * DBL_EPSILON * norm;
+  det = 1;
+  for (int c = 0; c < rows_; ++c) {
+    int pivotRow = c;
+    for (int r = c + 1; r < rows_; ++r) {
+      if (fabs(a[r][c]) > fabs(a[pivotRow][c])) {
+        pivotRow = r;
+      }
+    }
+    if (pivotRow != c) {
+      std::swap(a[pivotRow], a[c]);
+      std::swap(x[pivotRow], x[c]);
+      det = -det;
+    }
+    if (fabs(a[c][c]) <= tolerance) {
+      throw std::invalid_argument("Calculation error");
+    }
+    det *= a[c][c];
+    for (int r = c + 1; r < rows_; ++r) {
+      const double factor = a[r][c] / a[c][c];
+      if (factor == 0) {
+        continue;
+      }
+      for (int k = c + 1; k < cols_; ++k) {
+        a[r][k] -= factor * a[c][k];
+      }
+      for (int k = 0; k < res.cols_; ++k) {
+        x[r][k] -= factor * x[c][k];
+      }
+    }
+  }
+  for (int i = rows_ - 1; i >= 0; --i) {
+    for (int k = i + 1; k < cols_; ++k) {
+      for (int n = 0; n < res.cols_; ++n) {
+        x[i][n] -= a[i][k] * x[k][n];
+      }
+    }
+    for (int n = 0; n < res.cols_; ++n) {
+      x[i][n] /= a[i][i];
+    }
+  }
+  return res;
+}
+
+// Binary exponentiation over two ping-pong buffers: O(log k) products and no
+// allocation once the scratch matrix has grown. A negative power raises the
+// inverse, found through Solve
+Matrix Matrix::Power(const int &power) const {
+  if (rows_ != cols_ || rows_ == 0) {
+    throw std::out_of_range("Matrix is not square");
+  }
+  if (power == 0) {
+    return ScaledIdentity(rows_, 1);
+  }
+  Matrix base = (power > 0) ? *this : Solve(ScaledIdentity(rows_, 1));
+  Matrix res, scratch;
+  bool empty = true;
+  for (long long k = std::llabs(power); k > 0; k >>= 1) {
+    if (k & 1) {
+      if (empty) {
+        res = base;
+        empty = false;
+      } else {
+        MulKernel(res, base, scratch);
+        res.Swap(scratch);
+      }
+    }
+    if (k > 1) {
+      MulKernel(base, base, scratch);
+      base.Swap(scratch);
+    }
+  }
+  return res;
+}
+
+// Scaling and squaring with the diagonal Pade approximant
+// r_m = (V - U)^-1 (V + U), U holding the odd and V the even powers of A. The
+// smallest degree m whose bound covers the 1-norm is used; past the last
+// bound A is scaled by 2^-s and the result squared s times
+Matrix Matrix::Exp() const {
+  if (rows_ != cols_ || rows_ == 0) {
+    throw std::out_of_range("Matrix is not square");
+  }
+  double norm = 0;
+  for (int k = 0; k < cols_; ++k) {
+    double sum = 0;
+    for (int i = 0; i < rows_; ++i) {
+      sum += fabs(matrix_[i][k]);
+    }
+    norm = std::max(norm, sum);
+  }
+  const double *pade[] = {kPade3, kPade5, kPade7, kPade9, kPade13};
+  int degree = 4;
+  while (degree > 0 && norm <= kTheta[degree - 1]) {
+    --degree;
+  }
+  int squarings = 0;
+  if (degree == 4 && norm > kTheta[4]) {
+    squarings = std::ceil(std::log2(norm / kTheta[4]));
+  }
+  const double *b = pade[degree];
+  const int m = kDegrees[degree];
+  Matrix A(*this);
+  A.MulNumber(std::ldexp(1.0, -squarings));
+  std::vector<Matrix> powers(1);
+  MulKernel(A, A, powers[0]);
+  const int count = (m == 13) ? 3 : (m - 1) / 2;
+  for (int j = 1; j < count; ++j) {
+    powers.emplace_back();
+    MulKernel(powers[j - 1], powers[0], powers[j]);
+  }
+  Matrix odd = ScaledIdentity(rows_, b[1]);
+  Matrix V = ScaledIdentity(rows_, b[0]);
+  for (int j = 0; j < count; ++j) {
+    Axpy(b[2 * j + 3], powers[j], odd);
+    Axpy(b[2 * j + 2], powers[j], V);
+  }
+  Matrix scratch;
+  if (m == 13) {
+    // Degree 13 reuses A^6 for the high half: A^6 (b13 A^6 + b11 A^4 + ...)
+    Matrix high(powers[2]);
+    high.MulNumber(b[13]);
+    Axpy(b[11], powers[1], high);
+    Axpy(b[9], powers[0], high);
+    Gemm(1, powers[2], false, high, false, 1, odd);
+    high = powers[2];
+    high.MulNumber(b[12]);
+    Axpy(b[10], powers[1], high);
+    Axpy(b[8], powers[0], high);
+    Gemm(1, powers[2], false, high, false, 1, V);
+  }
+  Matrix U;
+  MulKernel(A, odd, U);
+  Matrix P(V);
+  P.SumMatrix(U);
+  V.SubMatrix(U);
+  Matrix res = V.Solve(P);
+  for (int s = 0; s < squarings; ++s) {
+    MulKernel(res, res, scratch);
+    res.Swap(scratch);
+  }
+  return res;
+}
+}  // namespace S21
\ No newline at end of file
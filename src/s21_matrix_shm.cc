@@ -0,0 +1,281 @@
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "s21_matrix_oop.hpp"
+
+namespace S21 {
+namespace {
+const size_t kJobHeader = 64;
+
+// Fork children and attached workers run the same job: this header followed
+// by both operands and the result, all row-major, in one shared mapping.
+// Output tiles of tile x tile elements are handed out through next and
+// counted in done once written
+struct Job {
+  std::atomic<int> ready, next, done;
+  int rows, inner, cols, tile;
+};
+static_assert(sizeof(Job) <= kJobHeader, "Job header does not fit");
+
+size_t JobSize(const int &rows, const int &inner, const int &cols) {
+  return kJobHeader + sizeof(double) * (static_cast<size_t>(rows) * inner +
+                                        static_cast<size_t>(inner) * cols +
+                                        static_cast<size_t>(rows) * cols);
+}
+
+double *Operand(Job *job, const int &which) {
+  double *data =
+      reinterpret_cast<double *>(reinterpret_cast<char *>(job) + kJobHeader);
+  if (which > 0) {
+    data += static_cast<size_t>(job->rows) * job->inner;
+  }
+  if (which > 1) {
+    data += static_cast<size_t>(job->inner) * job->cols;
+  }
+  return data;
+}
+
+int TaskCount(const Job *job) {
+  return ((job->rows + job->tile - 1) / job->tile) *
+         ((job->cols + job->tile - 1) / job->tile);
+}
+
+void CheckOperands(const Matrix &A, const Matrix &B, const int &processes,
+                   const int &tile) {
+  if (A.GetCols() != B.GetRows()) {
+    throw std::out_of_range(
+        "Columns of matrix_1 not equal to Rows of matrix_2");
+  }
+  if (A.GetCols() <= 0 || B.GetCols() <= 0 || A.GetRows() <= 0) {
+    throw std::invalid_argument(
+        "Some columns or some rows equal or less to zero");
+  }
+  if (processes <= 0 || tile <= 0) {
+    throw std::invalid_argument("Processes or tile less or equal to zero");
+  }
+}
+
+Job *CreateJob(void *data, const Matrix &A, const Matrix &B,
+               const int &tile) {
+  Job *job = new (data) Job();
+  job->rows = A.GetRows();
+  job->inner = A.GetCols();
+  job->cols = B.GetCols();
+  job->tile = tile;
+  for (int m = 0; m < job->rows; ++m) {
+    std::copy(A.GetMatrix()[m], A.GetMatrix()[m] + job->inner,
+              Operand(job, 0) + static_cast<size_t>(m) * job->inner);
+  }
+  for (int k = 0; k < job->inner; ++k) {
+    std::copy(B.GetMatrix()[k], B.GetMatrix()[k] + job->cols,
+              Operand(job, 1) + static_cast<size_t>(k) * job->cols);
+  }
+  job->ready.store(1);
+  return job;
+}
+
+// Works through the queue until it is empty, returns the tiles it computed
+int RunJob(Job *job) {
+  const int tasks = TaskCount(job);
+  const int tile = job->tile;
+  const int tileCols = (job->cols + tile - 1) / tile;
+  const double *a = Operand(job, 0);
+  const double *b = Operand(job, 1);
+  double *c = Operand(job, 2);
+  int tiles = 0;
+  for (int t = job->next.fetch_add(1); t < tasks; t = job->next.fetch_add(1)) {
+    const int row = (t / tileCols) * tile;
+    const int col = (t % tileCols) * tile;
+    const int rowEnd = std::min(row + tile, job->rows);
+    const int colEnd = std::min(col + tile, job->cols);
+    for (int m = row; m < rowEnd; ++m) {
+      double *res = c + static_cast<size_t>(m) * job->cols;
+      std::fill(res + col, res + colEnd, 0);
+      for (int k = 0; k < job->inner; ++k) {
+        const double value = a[static_cast<size_t>(m) * job->inner + k];
+        const double *other = b + static_cast<size_t>(k) * job->cols;
+        for (int n = col; n < colEnd; ++n) {
+          res[n] += value * other[n];
+        }
+      }
+    }
+    job->done.fetch_add(1);
+    ++tiles;
+  }
+  return tiles;
+}
+
+void TakeResult(Job *job, Matrix &res) {
+  res.SetRows(job->rows);
+  res.SetCols(job->cols);
+  const double *c = Operand(job, 2);
+  for (int m = 0; m < job->rows; ++m) {
+    std::copy(c + static_cast<size_t>(m) * job->cols,
+              c + static_cast<size_t>(m + 1) * job->cols, res.GetMatrix()[m]);
+  }
+}
+}  // namespace
+
+// Opens or creates the POSIX shared memory object name and maps rows * cols
+// doubles from it. A fresh object starts zeroed, an existing one must be at
+// least that large and is attached with its current contents
+Matrix::Matrix(const int &newRow, const int &newCol, const std::string &name)
+    : rows_{newRow},
+      cols_{newCol},
+      rowsCap_{newRow},
+      colsCap_{newCol},
+      matrix_{nullptr},
+      shm_{nullptr},
+      shmSize_{0} {
+  if (rows_ <= 0 || cols_ <= 0) {
+    throw std::invalid_argument("matrix_ parameters less or equal to zero");
+  }
+  const size_t size = sizeof(double) * rows_ * cols_;
+  const int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("Can not open shared memory object");
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      (info.st_size == 0 && ftruncate(fd, size) != 0)) {
+    close(fd);
+    throw std::runtime_error("Can not size shared memory object");
+  }
+  if (info.st_size != 0 && static_cast<size_t>(info.st_size) < size) {
+    close(fd);
+    throw std::invalid_argument("Shared memory object is smaller than matrix");
+  }
+  void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Can not map shared memory object");
+  }
+  shm_ = static_cast<double *>(data);
+  shmSize_ = size;
+  matrix_ = new double *[rows_];
+  for (int i = 0; i < rows_; ++i) {
+    matrix_[i] = shm_ + static_cast<size_t>(i) * cols_;
+  }
+}
+
+bool Matrix::IsShared() const { return shm_ != nullptr; }
+
+void Matrix::UnlinkShared(const std::string &name) { shm_unlink(name.c_str()); }
+
+// The caller creates the job under name, works through the queue itself and
+// waits until the tiles taken by attached workers are written. The name is
+// created exclusively, so a stale or concurrent job with it is an error
+void Matrix::MulMatrixShared(const Matrix &other, const std::string &name,
+                             const int &tile) {
+  CheckOperands(*this, other, 1, tile);
+  const size_t size = JobSize(rows_, cols_, other.cols_);
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("Can not open shared memory object");
+  }
+  void *data = MAP_FAILED;
+  if (ftruncate(fd, size) == 0) {
+    data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if (data == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    throw std::runtime_error("Can not map shared memory object");
+  }
+  Job *job = CreateJob(data, *this, other, tile);
+  RunJob(job);
+  const int tasks = TaskCount(job);
+  while (job->done.load() < tasks) {
+    sched_yield();
+  }
+  shm_unlink(name.c_str());
+  TakeResult(job, *this);
+  munmap(data, size);
+}
+
+// Attaches to the job a coordinator published under name, waiting for it to
+// be filled in, and returns the number of tiles this process computed
+int Matrix::MulMatrixWorker(const std::string &name) {
+  const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("Can not open shared memory object");
+  }
+  struct stat info;
+  info.st_size = 0;
+  while (static_cast<size_t>(info.st_size) < kJobHeader) {
+    if (fstat(fd, &info) != 0) {
+      close(fd);
+      throw std::runtime_error("Can not size shared memory object");
+    }
+    sched_yield();
+  }
+  void *data =
+      mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Can not map shared memory object");
+  }
+  Job *job = static_cast<Job *>(data);
+  while (job->ready.load() == 0) {
+    sched_yield();
+  }
+  int tiles = 0;
+  if (JobSize(job->rows, job->inner, job->cols) <=
+      static_cast<size_t>(info.st_size)) {
+    tiles = RunJob(job);
+  }
+  munmap(data, info.st_size);
+  return tiles;
+}
+
+// The same job in an anonymous mapping inherited by processes - 1 forked
+// children. A failed fork() only means fewer workers: the caller still
+// computes every remaining tile, so the product is kept and the number of
+// processes that took part is returned
+int Matrix::MulMatrixShared(const Matrix &other, const int &processes,
+                            const int &tile) {
+  CheckOperands(*this, other, processes, tile);
+  const size_t size = JobSize(rows_, cols_, other.cols_);
+  void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Can not map task queue");
+  }
+  Job *job = CreateJob(data, *this, other, tile);
+  std::vector<pid_t> workers;
+  for (int p = 1; p < processes; ++p) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+      RunJob(job);
+      _exit(0);
+    } else if (pid < 0) {
+      break;
+    }
+    workers.push_back(pid);
+  }
+  RunJob(job);
+  bool failed = false;
+  for (const pid_t &pid : workers) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+      failed = true;
+    }
+  }
+  if (!failed) {
+    TakeResult(job, *this);
+  }
+  munmap(data, size);
+  if (failed) {
+    throw std::runtime_error("Worker process failed");
+  }
+  return workers.size() + 1;
+}
+}  // namespace S21
@@ -0,0 +1,588 @@
+#include "s21_matrix_structured.hpp"
+
+namespace S21 {
+namespace {
+void CheckSize(const int &size) {
+  if (size <= 0) {
+    throw std::invalid_argument("matrix_ parameters less or equal to zero");
+  }
+}
+
+void CheckIndex(const int &i, const int &j, const int &size) {
+  if (i < 0 || j < 0 || i >= size || j >= size) {
+    throw std::out_of_range("Index less or grater than matrix size");
+  }
+}
+
+void CheckOperand(const Matrix &B, const int &size) {
+  if (B.GetRows() != size) {
+    throw std::out_of_range(
+        "Columns of matrix_1 not equal to Rows of matrix_2");
+  }
+  if (B.GetCols() <= 0) {
+    throw std::invalid_argument(
+        "Some columns or some rows equal or less to zero");
+  }
+}
+
+Matrix Identity(const int &size) {
+  Matrix res(size, size);
+  for (int i = 0; i < size; ++i) {
+    res(i, i) = 1;
+  }
+  return res;
+}
+
+// row += num * other over the first cols elements of two dense rows
+void AddRow(double *row, const double *other, const double &num,
+            const int &cols) {
+  for (int n = 0; n < cols; ++n) {
+    row[n] += num * other[n];
+  }
+}
+}  // namespace
+
+DiagonalMatrix::DiagonalMatrix(const int &size) : size_{size} {
+  CheckSize(size_);
+  diag_.assign(size_, 0);
+}
+
+int DiagonalMatrix::GetSize() const { return size_; }
+
+double DiagonalMatrix::Get(const int &i, const int &j) const {
+  CheckIndex(i, j, size_);
+  return (i == j) ? diag_[i] : 0;
+}
+
+double &DiagonalMatrix::operator()(const int &i, const int &j) {
+  CheckIndex(i, j, size_);
+  if (i != j) {
+    throw std::out_of_range("Element outside of matrix structure");
+  }
+  return diag_[i];
+}
+
+Matrix DiagonalMatrix::ToMatrix() const {
+  Matrix res(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    res(i, i) = diag_[i];
+  }
+  return res;
+}
+
+Matrix DiagonalMatrix::operator*(const Matrix &B) const {
+  CheckOperand(B, size_);
+  Matrix res(size_, B.GetCols());
+  for (int i = 0; i < size_; ++i) {
+    AddRow(res.GetMatrix()[i], B.GetMatrix()[i], diag_[i], B.GetCols());
+  }
+  return res;
+}
+
+Matrix DiagonalMatrix::Solve(const Matrix &B) const {
+  return InverseMatrix() * B;
+}
+
+double DiagonalMatrix::Determinant() const {
+  double det = 1;
+  for (int i = 0; i < size_; ++i) {
+    det *= diag_[i];
+  }
+  return det;
+}
+
+DiagonalMatrix DiagonalMatrix::InverseMatrix() const {
+  DiagonalMatrix res(size_);
+  for (int i = 0; i < size_; ++i) {
+    if (diag_[i] == 0) {
+      throw std::invalid_argument("Calculation error");
+    }
+    res.diag_[i] = 1 / diag_[i];
+  }
+  return res;
+}
+
+TriangularMatrix::TriangularMatrix(const int &size, const bool &upper)
+    : size_{size}, upper_{upper} {
+  CheckSize(size_);
+  data_.assign(size_ * (size_ + 1) / 2, 0);
+}
+
+int TriangularMatrix::Index(const int &i, const int &j) const {
+  if (upper_) {
+    return (j < i) ? -1 : i * size_ - i * (i - 1) / 2 + (j - i);
+  }
+  return (j > i) ? -1 : i * (i + 1) / 2 + j;
+}
+
+int TriangularMatrix::GetSize() const { return size_; }
+
+bool TriangularMatrix::IsUpper() const { return upper_; }
+
+double TriangularMatrix::Get(const int &i, const int &j) const {
+  CheckIndex(i, j, size_);
+  const int idx = Index(i, j);
+  return (idx < 0) ? 0 : data_[idx];
+}
+
+double &TriangularMatrix::operator()(const int &i, const int &j) {
+  CheckIndex(i, j, size_);
+  const int idx = Index(i, j);
+  if (idx < 0) {
+    throw std::out_of_range("Element outside of matrix structure");
+  }
+  return data_[idx];
+}
+
+Matrix TriangularMatrix::ToMatrix() const {
+  Matrix res(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    for (int j = upper_ ? i : 0; j < (upper_ ? size_ : i + 1); ++j) {
+      res(i, j) = data_[Index(i, j)];
+    }
+  }
+  return res;
+}
+
+Matrix TriangularMatrix::operator*(const Matrix &B) const {
+  CheckOperand(B, size_);
+  const int cols = B.GetCols();
+  Matrix res(size_, cols);
+  for (int i = 0; i < size_; ++i) {
+    const double *row = &data_[Index(i, upper_ ? i : 0)];
+    const int first = upper_ ? i : 0;
+    const int last = upper_ ? size_ : i + 1;
+    for (int k = first; k < last; ++k) {
+      AddRow(res.GetMatrix()[i], B.GetMatrix()[k], row[k - first], cols);
+    }
+  }
+  return res;
+}
+
+// Forward substitution for lower, backward for upper, one row of X at a time
+Matrix TriangularMatrix::Solve(const Matrix &B) const {
+  CheckOperand(B, size_);
+  const int cols = B.GetCols();
+  Matrix res(B);
+  double **x = res.GetMatrix();
+  for (int t = 0; t < size_; ++t) {
+    const int i = upper_ ? size_ - 1 - t : t;
+    const double pivot = data_[Index(i, i)];
+    if (pivot == 0) {
+      throw std::invalid_argument("Calculation error");
+    }
+    for (int k = upper_ ? i + 1 : 0; k < (upper_ ? size_ : i); ++k) {
+      AddRow(x[i], x[k], -data_[Index(i, k)], cols);
+    }
+    for (int n = 0; n < cols; ++n) {
+      x[i][n] /= pivot;
+    }
+  }
+  return res;
+}
+
+double TriangularMatrix::Determinant() const {
+  double det = 1;
+  for (int i = 0; i < size_; ++i) {
+    det *= data_[Index(i, i)];
+  }
+  return det;
+}
+
+// Column by column substitution against the identity, touching only the
+// triangle that stays non-zero
+TriangularMatrix TriangularMatrix::InverseMatrix() const {
+  TriangularMatrix res(size_, upper_);
+  for (int j = 0; j < size_; ++j) {
+    const double pivot = data_[Index(j, j)];
+    if (pivot == 0) {
+      throw std::invalid_argument("Calculation error");
+    }
+    res.data_[Index(j, j)] = 1 / pivot;
+    for (int t = 1; t < (upper_ ? j + 1 : size_ - j); ++t) {
+      const int i = upper_ ? j - t : j + t;
+      double sum = 0;
+      for (int k = upper_ ? i + 1 : j; k < (upper_ ? j + 1 : i); ++k) {
+        sum += data_[Index(i, k)] * res.data_[Index(k, j)];
+      }
+      res.data_[Index(i, j)] = -sum / data_[Index(i, i)];
+    }
+  }
+  return res;
+}
+
+SymmetricMatrix::SymmetricMatrix(const int &size) : size_{size} {
+  CheckSize(size_);
+  data_.assign(size_ * (size_ + 1) / 2, 0);
+}
+
+int SymmetricMatrix::Index(const int &i, const int &j) const {
+  return (j > i) ? j * (j + 1) / 2 + i : i * (i + 1) / 2 + j;
+}
+
+// LDL^T with Bunch-Kaufman pivoting in the packed layout: P A P^T = L D L^T
+// where D has 1x1 and 2x2 blocks. The diagonal of ld holds D, including the
+// off-diagonal element of each 2x2 block, the rest of the strict lower part
+// the unit lower factor L. pivots[k] is the row swapped with row k, or -1 at
+// the first row of a 2x2 block. Returns false when the matrix is singular
+bool SymmetricMatrix::Factorize(std::vector<double> &ld,
+                                std::vector<int> &pivots) const {
+  const double alpha = (1 + std::sqrt(17.0)) / 8;
+  ld = data_;
+  pivots.assign(size_, 0);
+  auto at = [&](const int &i, const int &j) -> double & {
+    return ld[Index(i, j)];
+  };
+  for (int k = 0; k < size_;) {
+    const double diag = fabs(at(k, k));
+    int imax = k;
+    double colmax = 0;
+    for (int i = k + 1; i < size_; ++i) {
+      if (fabs(at(i, k)) > colmax) {
+        colmax = fabs(at(i, k));
+        imax = i;
+      }
+    }
+    if (std::max(diag, colmax) == 0) {
+      return false;
+    }
+    int step = 1, kp = k;
+    if (diag < alpha * colmax) {
+      double rowmax = 0;
+      for (int j = k; j < size_; ++j) {
+        if (j != imax) {
+          rowmax = std::max(rowmax, fabs(at(imax, j)));
+        }
+      }
+      if (diag * rowmax < alpha * colmax * colmax) {
+        kp = imax;
+        step = (fabs(at(imax, imax)) >= alpha * rowmax) ? 1 : 2;
+      }
+    }
+    const int kk = k + step - 1;
+    if (kp != kk) {
+      for (int j = 0; j < size_; ++j) {
+        if (j != kk && j != kp) {
+          std::swap(at(kk, j), at(kp, j));
+        }
+      }
+      std::swap(at(kk, kk), at(kp, kp));
+    }
+    if (step == 1) {
+      pivots[k] = kp;
+      const double d = at(k, k);
+      for (int j = k + 1; j < size_; ++j) {
+        const double l = at(j, k) / d;
+        for (int i = j; i < size_; ++i) {
+          at(i, j) -= at(i, k) * l;
+        }
+      }
+      for (int i = k + 1; i < size_; ++i) {
+        at(i, k) /= d;
+      }
+    } else {
+      pivots[k] = -1;
+      pivots[k + 1] = kp;
+      const double d11 = at(k, k), d21 = at(k + 1, k), d22 = at(k + 1, k + 1);
+      const double det = d11 * d22 - d21 * d21;
+      if (det == 0) {
+        return false;
+      }
+      for (int j = k + 2; j < size_; ++j) {
+        const double l1 = (at(j, k) * d22 - at(j, k + 1) * d21) / det;
+        const double l2 = (at(j, k + 1) * d11 - at(j, k) * d21) / det;
+        for (int i = j; i < size_; ++i) {
+          at(i, j) -= at(i, k) * l1 + at(i, k + 1) * l2;
+        }
+      }
+      for (int i = k + 2; i < size_; ++i) {
+        const double c1 = at(i, k), c2 = at(i, k + 1);
+        at(i, k) = (c1 * d22 - c2 * d21) / det;
+        at(i, k + 1) = (c2 * d11 - c1 * d21) / det;
+      }
+    }
+    k += step;
+  }
+  return true;
+}
+
+int SymmetricMatrix::GetSize() const { return size_; }
+
+double SymmetricMatrix::Get(const int &i, const int &j) const {
+  CheckIndex(i, j, size_);
+  return data_[Index(i, j)];
+}
+
+double &SymmetricMatrix::operator()(const int &i, const int &j) {
+  CheckIndex(i, j, size_);
+  return data_[Index(i, j)];
+}
+
+Matrix SymmetricMatrix::ToMatrix() const {
+  Matrix res(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      res(i, j) = res(j, i) = data_[Index(i, j)];
+    }
+  }
+  return res;
+}
+
+// Each stored element (i, k) contributes to both row i and row k
+Matrix SymmetricMatrix::operator*(const Matrix &B) const {
+  CheckOperand(B, size_);
+  const int cols = B.GetCols();
+  Matrix res(size_, cols);
+  double **r = res.GetMatrix();
+  double **b = B.GetMatrix();
+  for (int i = 0; i < size_; ++i) {
+    for (int k = 0; k < i; ++k) {
+      const double s = data_[Index(i, k)];
+      AddRow(r[i], b[k], s, cols);
+      AddRow(r[k], b[i], s, cols);
+    }
+    AddRow(r[i], b[i], data_[Index(i, i)], cols);
+  }
+  return res;
+}
+
+// The row swaps are applied to B in factorization order, then L, D and L^T
+// are solved in turn and the swaps undone in reverse order. The element
+// below the diagonal of a 2x2 block belongs to D, not to L
+Matrix SymmetricMatrix::Solve(const Matrix &B) const {
+  CheckOperand(B, size_);
+  std::vector<double> ld;
+  std::vector<int> pivots;
+  if (!Factorize(ld, pivots)) {
+    throw std::invalid_argument("Calculation error");
+  }
+  const int cols = B.GetCols();
+  Matrix res(B);
+  double **x = res.GetMatrix();
+  for (int k = 0; k < size_; ++k) {
+    if (pivots[k] >= 0) {
+      std::swap(x[k], x[pivots[k]]);
+    }
+  }
+  for (int i = 0; i < size_; ++i) {
+    for (int k = 0; k < i; ++k) {
+      if (k + 1 != i || pivots[k] >= 0) {
+        AddRow(x[i], x[k], -ld[Index(i, k)], cols);
+      }
+    }
+  }
+  for (int k = 0; k < size_; ++k) {
+    if (pivots[k] >= 0) {
+      for (int n = 0; n < cols; ++n) {
+        x[k][n] /= ld[Index(k, k)];
+      }
+      continue;
+    }
+    const double d11 = ld[Index(k, k)], d21 = ld[Index(k + 1, k)];
+    const double d22 = ld[Index(k + 1, k + 1)];
+    const double det = d11 * d22 - d21 * d21;
+    for (int n = 0; n < cols; ++n) {
+      const double x1 = x[k][n], x2 = x[k + 1][n];
+      x[k][n] = (x1 * d22 - x2 * d21) / det;
+      x[k + 1][n] = (x2 * d11 - x1 * d21) / det;
+    }
+    ++k;
+  }
+  for (int i = size_ - 1; i >= 0; --i) {
+    for (int k = i + 1; k < size_; ++k) {
+      if (k != i + 1 || pivots[i] >= 0) {
+        AddRow(x[i], x[k], -ld[Index(k, i)], cols);
+      }
+    }
+  }
+  for (int k = size_ - 1; k >= 0; --k) {
+    if (pivots[k] >= 0) {
+      std::swap(x[k], x[pivots[k]]);
+    }
+  }
+  return res;
+}
+
+double SymmetricMatrix::Determinant() const {
+  std::vector<double> ld;
+  std::vector<int> pivots;
+  if (!Factorize(ld, pivots)) {
+    return 0;
+  }
+  double det = 1;
+  for (int k = 0; k < size_; ++k) {
+    if (pivots[k] >= 0) {
+      det *= ld[Index(k, k)];
+    } else {
+      const double d21 = ld[Index(k + 1, k)];
+      det *= ld[Index(k, k)] * ld[Index(k + 1, k + 1)] - d21 * d21;
+      ++k;
+    }
+  }
+  return det;
+}
+
+SymmetricMatrix SymmetricMatrix::InverseMatrix() const {
+  Matrix inverse = Solve(Identity(size_));
+  SymmetricMatrix res(size_);
+  for (int i = 0; i < size_; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      res.data_[Index(i, j)] = inverse(i, j);
+    }
+  }
+  return res;
+}
+
+BandedMatrix::BandedMatrix(const int &size, const int &lower,
+                           const int &upper)
+    : size_{size}, lower_{lower}, upper_{upper} {
+  CheckSize(size_);
+  if (lower_ < 0 || upper_ < 0) {
+    throw std::invalid_argument("Bandwidth is less than zero");
+  }
+  data_.assign(size_ * (lower_ + upper_ + 1), 0);
+}
+
+int BandedMatrix::Index(const int &i, const int &j) const {
+  if (j < i - lower_ || j > i + upper_) {
+    return -1;
+  }
+  return i * (lower_ + upper_ + 1) + (j - i + lower_);
+}
+
+// Band LU with partial pivoting. Row swaps let U grow to lower_ + upper_
+// super-diagonals, so lu keeps rows of 2 * lower_ + upper_ + 1 elements
+// (see FactorIndex). Column k of L is stored below the diagonal of lu and
+// pivots[k] is the row swapped with row k at step k. Returns the sign of the
+// permutation, or 0 when the matrix is singular
+int BandedMatrix::Factorize(std::vector<double> &lu,
+                            std::vector<int> &pivots) const {
+  lu.assign(size_ * (2 * lower_ + upper_ + 1), 0);
+  pivots.assign(size_, 0);
+  for (int i = 0; i < size_; ++i) {
+    for (int j = std::max(0, i - lower_); j < size_ && j <= i + upper_; ++j) {
+      lu[FactorIndex(i, j)] = data_[Index(i, j)];
+    }
+  }
+  int sign = 1;
+  for (int k = 0; k < size_; ++k) {
+    const int last = std::min(size_ - 1, k + lower_);
+    const int right = std::min(size_ - 1, k + lower_ + upper_);
+    int pivotRow = k;
+    for (int i = k + 1; i <= last; ++i) {
+      if (fabs(lu[FactorIndex(i, k)]) > fabs(lu[FactorIndex(pivotRow, k)])) {
+        pivotRow = i;
+      }
+    }
+    pivots[k] = pivotRow;
+    if (pivotRow != k) {
+      for (int j = k; j <= right; ++j) {
+        std::swap(lu[FactorIndex(k, j)], lu[FactorIndex(pivotRow, j)]);
+      }
+      sign = -sign;
+    }
+    const double pivot = lu[FactorIndex(k, k)];
+    if (pivot == 0) {
+      return 0;
+    }
+    for (int i = k + 1; i <= last; ++i) {
+      const double l = lu[FactorIndex(i, k)] / pivot;
+      lu[FactorIndex(i, k)] = l;
+      for (int j = k + 1; j <= right; ++j) {
+        lu[FactorIndex(i, j)] -= l * lu[FactorIndex(k, j)];
+      }
+    }
+  }
+  return sign;
+}
+
+int BandedMatrix::FactorIndex(const int &i, const int &j) const {
+  return i * (2 * lower_ + upper_ + 1) + (j - i + lower_);
+}
+
+int BandedMatrix::GetSize() const { return size_; }
+
+int BandedMatrix::GetLower() const { return lower_; }
+
+int BandedMatrix::GetUpper() const { return upper_; }
+
+double BandedMatrix::Get(const int &i, const int &j) const {
+  CheckIndex(i, j, size_);
+  const int idx = Index(i, j);
+  return (idx < 0) ? 0 : data_[idx];
+}
+
+double &BandedMatrix::operator()(const int &i, const int &j) {
+  CheckIndex(i, j, size_);
+  const int idx = Index(i, j);
+  if (idx < 0) {
+    throw std::out_of_range("Element outside of matrix structure");
+  }
+  return data_[idx];
+}
+
+Matrix BandedMatrix::ToMatrix() const {
+  Matrix res(size_, size_);
+  for (int i = 0; i < size_; ++i) {
+    for (int j = std::max(0, i - lower_); j < size_ && j <= i + upper_; ++j) {
+      res(i, j) = data_[Index(i, j)];
+    }
+  }
+  return res;
+}
+
+Matrix BandedMatrix::operator*(const Matrix &B) const {
+  CheckOperand(B, size_);
+  const int cols = B.GetCols();
+  Matrix res(size_, cols);
+  for (int i = 0; i < size_; ++i) {
+    for (int k = std::max(0, i - lower_); k < size_ && k <= i + upper_; ++k) {
+      AddRow(res.GetMatrix()[i], B.GetMatrix()[k], data_[Index(i, k)], cols);
+    }
+  }
+  return res;
+}
+
+// Swaps and L are applied step by step in factorization order, then U is
+// back-substituted over its lower_ + upper_ super-diagonals
+Matrix BandedMatrix::Solve(const Matrix &B) const {
+  CheckOperand(B, size_);
+  std::vector<double> lu;
+  std::vector<int> pivots;
+  if (Factorize(lu, pivots) == 0) {
+    throw std::invalid_argument("Calculation error");
+  }
+  const int cols = B.GetCols();
+  Matrix res(B);
+  double **x = res.GetMatrix();
+  for (int k = 0; k < size_; ++k) {
+    std::swap(x[k], x[pivots[k]]);
+    for (int i = k + 1; i < size_ && i <= k + lower_; ++i) {
+      AddRow(x[i], x[k], -lu[FactorIndex(i, k)], cols);
+    }
+  }
+  for (int i = size_ - 1; i >= 0; --i) {
+    for (int k = i + 1; k < size_ && k <= i + lower_ + upper_; ++k) {
+      AddRow(x[i], x[k], -lu[FactorIndex(i, k)], cols);
+    }
+    for (int n = 0; n < cols; ++n) {
+      x[i][n] /= lu[FactorIndex(i, i)];
+    }
+  }
+  return res;
+}
+
+double BandedMatrix::Determinant() const {
+  std::vector<double> lu;
+  std::vector<int> pivots;
+  double det = Factorize(lu, pivots);
+  for (int i = 0; i < size_ && det != 0; ++i) {
+    det *= lu[FactorIndex(i, i)];
+  }
+  return det;
+}
+
+Matrix BandedMatrix::InverseMatrix() const {
+  return Solve(Identity(size_));
+}
+}  // namespace S21
\ No newline at end of file
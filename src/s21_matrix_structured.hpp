@@ -0,0 +1,111 @@
+#ifndef S21_MATRIX_STRUCTURED_H_
+#define S21_MATRIX_STRUCTURED_H_
+
+#include "s21_matrix_oop.hpp"
+
+// Square matrices with a known zero pattern. Only the structurally non-zero
+// elements are stored, operator() throws on the others and Get() reads them
+// as zero. Products, solves and inverses return dense S21::Matrix results
+// unless the structure is closed under the operation
+namespace S21 {
+class DiagonalMatrix {
+ private:
+  int size_;
+  std::vector<double> diag_;
+
+ public:
+  explicit DiagonalMatrix(const int &);
+
+  int GetSize() const;
+  double Get(const int &, const int &) const;
+  double &operator()(const int &, const int &);
+  Matrix ToMatrix() const;
+
+  Matrix operator*(const Matrix &) const;
+  Matrix Solve(const Matrix &) const;
+  double Determinant() const;
+  DiagonalMatrix InverseMatrix() const;
+};
+
+// Packed row by row: n * (n + 1) / 2 elements
+class TriangularMatrix {
+ private:
+  int size_;
+  bool upper_;
+  std::vector<double> data_;
+
+ protected:
+  int Index(const int &, const int &) const;
+
+ public:
+  TriangularMatrix(const int &, const bool &);
+
+  int GetSize() const;
+  bool IsUpper() const;
+  double Get(const int &, const int &) const;
+  double &operator()(const int &, const int &);
+  Matrix ToMatrix() const;
+
+  Matrix operator*(const Matrix &) const;
+  Matrix Solve(const Matrix &) const;
+  double Determinant() const;
+  TriangularMatrix InverseMatrix() const;
+};
+
+// Stores the lower half only, (i, j) and (j, i) refer to the same element.
+// Solve and Determinant go through an LDL^T factorization with
+// Bunch-Kaufman pivoting, so indefinite matrices are handled as well
+class SymmetricMatrix {
+ private:
+  int size_;
+  std::vector<double> data_;
+
+ protected:
+  int Index(const int &, const int &) const;
+  bool Factorize(std::vector<double> &, std::vector<int> &) const;
+
+ public:
+  explicit SymmetricMatrix(const int &);
+
+  int GetSize() const;
+  double Get(const int &, const int &) const;
+  double &operator()(const int &, const int &);
+  Matrix ToMatrix() const;
+
+  Matrix operator*(const Matrix &) const;
+  Matrix Solve(const Matrix &) const;
+  double Determinant() const;
+  SymmetricMatrix InverseMatrix() const;
+};
+
+// Keeps lower sub- and upper super-diagonals as size rows of
+// lower + upper + 1 elements. Solve and Determinant use a band LU with
+// partial pivoting, O(size * lower * (lower + upper))
+class BandedMatrix {
+ private:
+  int size_, lower_, upper_;
+  std::vector<double> data_;
+
+ protected:
+  int Index(const int &, const int &) const;
+  int FactorIndex(const int &, const int &) const;
+  int Factorize(std::vector<double> &, std::vector<int> &) const;
+
+ public:
+  BandedMatrix(const int &, const int &, const int &);
+
+  int GetSize() const;
+  int GetLower() const;
+  int GetUpper() const;
+  double Get(const int &, const int &) const;
+  double &operator()(const int &, const int &);
+  Matrix ToMatrix() const;
+
+  Matrix operator*(const Matrix &) const;
+  Matrix Solve(const Matrix &) const;
+  double Determinant() const;
+  Matrix InverseMatrix() const;
+};
+}  // namespace S21
+
+#endif  //  S21_MATRIX_STRUCTURED_H_
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "s21_matrix_tracker.hpp"
+
+namespace S21 {
+namespace {
+Matrix Identity(const int &size) {
+  Matrix res(size, size);
+  for (int i = 0; i < size; ++i) {
+    res(i, i) = 1;
+  }
+  return res;
+}
+}  // namespace
+
+InverseTracker::InverseTracker(const Matrix &matrix, const int &refactorEvery)
+    : matrix_{matrix}, det_{0}, updates_{0}, refactorEvery_{refactorEvery} {
+  if (matrix_.GetRows() != matrix_.GetCols() || matrix_.GetRows() == 0) {
+    throw std::out_of_range("Matrix is not square");
+  }
+  if (refactorEvery_ <= 0) {
+    throw std::invalid_argument(
+        "Refactorization period less or equal to zero");
+  }
+  Refactorize();
+}
+
+const Matrix &InverseTracker::GetMatrix() const { return matrix_; }
+
+const Matrix &InverseTracker::GetInverse() const { return inverse_; }
+
+double InverseTracker::GetDeterminant() const { return det_; }
+
+int InverseTracker::GetUpdates() const { return updates_; }
+
+void InverseTracker::RankOneUpdate(const Matrix &u, const Matrix &v) {
+  if (u.GetCols() != 1 || v.GetCols() != 1) {
+    throw std::out_of_range("Vector size not equal to Columns of matrix");
+  }
+  RankUpdate(u, v);
+}
+
+// With W = A^-1 U and C = I + V^T W:
+//   (A + U V^T)^-1 = A^-1 - W C^-1 V^T A^-1,  det(A + U V^T) = det(A) det(C)
+// where C^-1 V^T A^-1 is solved for directly
+// A near-singular C means the update lost too much precision, so the state is
+// rebuilt from the updated matrix instead. The updated matrix is built aside
+// and swapped in only once its inverse is known
+void InverseTracker::RankUpdate(const Matrix &U, const Matrix &V) {
+  const int size = matrix_.GetRows();
+  if (U.GetRows() != size || V.GetRows() != size ||
+      U.GetCols() != V.GetCols() || U.GetCols() <= 0) {
+    throw std::out_of_range("Matrix parameters are not equal to each other");
+  }
+  updated_ = matrix_;
+  Gemm(1, U, false, V, true, 1, updated_);
+  if (updates_ + 1 >= refactorEvery_) {
+    Rebuild(updated_);
+    return;
+  }
+  Gemm(1, inverse_, false, U, false, 0, left_);
+  Gemm(1, V, true, inverse_, false, 0, right_);
+  Gemm(1, V, true, left_, false, 0, small_);
+  for (int i = 0; i < small_.GetRows(); ++i) {
+    small_(i, i) += 1;
+  }
+  double factor = 0;
+  Matrix scaled;
+  try {
+    scaled = small_.Solve(right_, factor);
+  } catch (const std::invalid_argument &) {
+    Rebuild(updated_);
+    return;
+  }
+  Gemm(-1, left_, false, scaled, false, 1, inverse_);
+  det_ *= factor;
+  matrix_.Swap(updated_);
+  ++updates_;
+}
+
+void InverseTracker::Refactorize() { Rebuild(matrix_); }
+
+// Inverts source through Matrix::Solve first, a singular source throws
+// before any member is touched. On success source becomes the tracked matrix
+void InverseTracker::Rebuild(Matrix &source) {
+  double det = 0;
+  Matrix inverse = source.Solve(Identity(source.GetRows()), det);
+  inverse_.Swap(inverse);
+  if (&source != &matrix_) {
+    matrix_.Swap(source);
+  }
+  det_ = det;
+  updates_ = 0;
+}
+}  // namespace S21
@@ -0,0 +1,36 @@
+#ifndef S21_MATRIX_TRACKER_H_
+#define S21_MATRIX_TRACKER_H_
+
+#include "s21_matrix_oop.hpp"
+
+// Keeps the inverse and determinant of a square matrix current under low-rank
+// updates A += U * V^T: Sherman-Morrison-Woodbury for the inverse and the
+// matrix determinant lemma for the determinant, O(n^2 k) per update. Every
+// refactorEvery updates both are recomputed from A to bound the drift. An
+// update that would make A singular throws and leaves the tracker unchanged
+namespace S21 {
+class InverseTracker {
+ private:
+  Matrix matrix_, inverse_;
+  double det_;
+  int updates_, refactorEvery_;
+  Matrix left_, right_, small_, updated_;
+
+ protected:
+  void Rebuild(Matrix &);
+
+ public:
+  explicit InverseTracker(const Matrix &, const int &refactorEvery = 64);
+
+  const Matrix &GetMatrix() const;
+  const Matrix &GetInverse() const;
+  double GetDeterminant() const;
+  int GetUpdates() const;
+
+  void RankOneUpdate(const Matrix &, const Matrix &);
+  void RankUpdate(const Matrix &, const Matrix &);
+  void Refactorize();
+};
+}  // namespace S21
+
+#endif  //  S21_MATRIX_TRACKER_H_
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "s21_matrix_oop.hpp"
 
+#include <sys/mman.h>
+
 // Support functions
 namespace S21 {
 void Matrix::InitializeMatrix() {
   if (rows_ <= 0 && cols_ <= 0) {
     throw std::invalid_argument("matrix_ parameters less or equal to zero");
   }
+  rowsCap_ = rows_;
+  colsCap_ = cols_;
   matrix_ = new double *[rows_];
   for (int i = 0; i < rows_; ++i) {
     matrix_[i] = new double[cols_];
@@ -16,15 +20,34 @@ void Matrix::InitializeMatrix() {
 }
 
 void Matrix::DeleteMatrix() {
+  if (shm_) {
+    delete[] matrix_;
+    matrix_ = nullptr;
+    munmap(shm_, shmSize_);
+    shm_ = nullptr;
+    shmSize_ = 0;
+  }
   if (matrix_) {
-    for (int i = 0; i < rows_; ++i) {
+    for (int i = 0; i < rowsCap_; ++i) {
       delete[] matrix_[i];
     }
     delete[] matrix_;
     matrix_ = nullptr;
-    rows_ = 0;
-    cols_ = 0;
   }
+  rows_ = 0;
+  cols_ = 0;
+  rowsCap_ = 0;
+  colsCap_ = 0;
+}
+
+void Matrix::Swap(Matrix &other) noexcept {
+  std::swap(rows_, other.rows_);
+  std::swap(cols_, other.cols_);
+  std::swap(rowsCap_, other.rowsCap_);
+  std::swap(colsCap_, other.colsCap_);
+  std::swap(matrix_, other.matrix_);
+  std::swap(shm_, other.shm_);
+  std::swap(shmSize_, other.shmSize_);
 }
 
 bool Matrix::SizeCompare(const Matrix &other) const {
@@ -63,14 +86,117 @@ void Matrix::CutMatrix(Matrix &A, const int &rows_del, const int &columns_del,
 }
 
 void Matrix::CopyMatrix(const Matrix &A) {
-  if (!EqMatrix(A)) {
-    DeleteMatrix();
-    rows_ = A.rows_;
-    cols_ = A.cols_;
-    InitializeMatrix();
-    for (int i = 0; i < rows_; ++i) {
-      for (int k = 0; k < cols_; ++k) {
-        matrix_[i][k] = A.matrix_[i][k];
+  if (&A == this) {
+    return;
+  }
+  ResizeMatrix(A.rows_, A.cols_);
+  for (int i = 0; i < rows_; ++i) {
+    for (int k = 0; k < cols_; ++k) {
+      matrix_[i][k] = A.matrix_[i][k];
+    }
+  }
+}
+
+// Every row of the table owns colsCap_ doubles, including the spare rows
+// between rows_ and rowsCap_, so appending a row never allocates
+void Matrix::GrowRowsCapacity(const int &newCap) {
+  if (shm_) {
+    throw std::out_of_range("Shared matrix can not grow past its capacity");
+  }
+  double **newMatrix = new double *[newCap];
+  for (int i = 0; i < rowsCap_; ++i) {
+    newMatrix[i] = matrix_[i];
+  }
+  for (int i = rowsCap_; i < newCap; ++i) {
+    newMatrix[i] = new double[colsCap_];
+  }
+  delete[] matrix_;
+  matrix_ = newMatrix;
+  rowsCap_ = newCap;
+}
+
+void Matrix::GrowColsCapacity(const int &newCap) {
+  if (shm_) {
+    throw std::out_of_range("Shared matrix can not grow past its capacity");
+  }
+  for (int i = 0; i < rowsCap_; ++i) {
+    double *newRow = new double[newCap];
+    for (int k = 0; i < rows_ && k < cols_; ++k) {
+      newRow[k] = matrix_[i][k];
+    }
+    delete[] matrix_[i];
+    matrix_[i] = newRow;
+  }
+  colsCap_ = newCap;
+}
+
+// Shrinking only moves rows_/cols_, growing within capacity zeroes the cells
+// that become visible
+void Matrix::ResizeMatrix(const int &newRows, const int &newCols) {
+  if (newCols > colsCap_) {
+    GrowColsCapacity(std::max(newCols, colsCap_ * 2));
+  }
+  if (newRows > rowsCap_) {
+    GrowRowsCapacity(std::max(newRows, rowsCap_ * 2));
+  }
+  for (int i = 0; i < newRows; ++i) {
+    for (int k = (i < rows_) ? cols_ : 0; k < newCols; ++k) {
+      matrix_[i][k] = 0;
+    }
+  }
+  rows_ = newRows;
+  cols_ = newCols;
+}
+
+void Matrix::MulKernel(const Matrix &A, const Matrix &B, Matrix &R) {
+  R.ResizeMatrix(A.rows_, B.cols_);
+  GemmKernel(1, A, false, B, false, 0, R, A.cols_);
+}
+
+// Loop order is picked per transpose case so the innermost loop walks rows
+// of the operands; with both transposed that row is a row of A and C is
+// written down a column. beta == 0 overwrites C without reading it
+void Matrix::GemmKernel(const double &alpha, const Matrix &A,
+                        const bool &transA, const Matrix &B,
+                        const bool &transB, const double &beta, Matrix &C,
+                        const int &inner) {
+  for (int m = 0; m < C.rows_; ++m) {
+    double *row = C.matrix_[m];
+    for (int n = 0; n < C.cols_; ++n) {
+      row[n] = (beta == 0) ? 0 : row[n] * beta;
+    }
+  }
+  if (transA && transB) {
+    for (int k = 0; k < inner; ++k) {
+      const double *a = A.matrix_[k];
+      for (int n = 0; n < C.cols_; ++n) {
+        const double b = alpha * B.matrix_[n][k];
+        for (int m = 0; m < C.rows_; ++m) {
+          C.matrix_[m][n] += a[m] * b;
+        }
+      }
+    }
+    return;
+  }
+  for (int m = 0; m < C.rows_; ++m) {
+    double *row = C.matrix_[m];
+    if (!transB) {
+      for (int k = 0; k < inner; ++k) {
+        const double a = alpha * (transA ? A.matrix_[k][m] : A.matrix_[m][k]);
+        const double *other = B.matrix_[k];
+        for (int n = 0; n < C.cols_; ++n) {
+          row[n] += a * other[n];
+        }
+      }
+    } else {
+      const double *a = A.matrix_[m];
+      for (int n = 0; n < C.cols_; ++n) {
+        const double *other = B.matrix_[n];
+        double dot = 0;
+        for (int k = 0; k < inner; ++k) {
+          dot += a[k] * other[k];
+        }
+        row[n] += alpha * dot;
       }
     }
   }
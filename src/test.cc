@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <sstream>
 
 #include "s21_matrix_oop.hpp"
+#include "s21_matrix_structured.hpp"
+#include "s21_matrix_tracker.hpp"
 
 namespace TestCase {
 void genMatrix(double ***matrix, const int &rows, const int &cols) {
@@ -124,6 +130,94 @@ TEST(Setters, SetMatrix) {
   TestCase::deleteMatrix(&newMatrix, rows);
 }
 
+TEST(Setters, ColsKeepRows) {
+  S21::Matrix matrix(3, 4);
+  matrix.SetCols(6);
+  ASSERT_TRUE(matrix.GetRows() == 3 && matrix.GetCols() == 6);
+}
+
+TEST(Capacity, Reserve) {
+  S21::Matrix matrix(2, 3);
+  TestCase::fillMatrix(matrix);
+  S21::Matrix matrixCopy(matrix);
+  matrix.Reserve(10, 8);
+  ASSERT_TRUE(matrix.GetRowsCapacity() == 10 &&
+              matrix.GetColsCapacity() == 8 && matrix == matrixCopy);
+}
+
+TEST(Capacity, ShrinkKeepsBuffer) {
+  S21::Matrix matrix(5, 5);
+  TestCase::fillMatrix(matrix);
+  const double value = matrix(1, 1);
+  double *row = matrix.GetMatrix()[1];
+  matrix.SetRows(2);
+  matrix.SetCols(2);
+  ASSERT_TRUE(matrix.GetRowsCapacity() == 5 &&
+              matrix.GetColsCapacity() == 5 &&
+              matrix.GetMatrix()[1] == row && matrix(1, 1) == value);
+}
+
+TEST(Capacity, RegrowZeroes) {
+  S21::Matrix matrix(3, 3);
+  TestCase::fillMatrix(matrix);
+  matrix(2, 2) = 1;
+  matrix.SetRows(1);
+  matrix.SetCols(1);
+  matrix.SetRows(3);
+  matrix.SetCols(3);
+  ASSERT_TRUE(matrix(2, 2) == 0 && matrix(0, 2) == 0);
+}
+
+TEST(Capacity, ShrinkToFit) {
+  S21::Matrix matrix(5, 5);
+  TestCase::fillMatrix(matrix);
+  S21::Matrix matrixCopy(matrix);
+  matrix.SetRows(2);
+  matrix.ShrinkToFit();
+  matrixCopy.SetRows(2);
+  ASSERT_TRUE(matrix.GetRowsCapacity() == 2 &&
+              matrix.GetColsCapacity() == 5 && matrix == matrixCopy);
+}
+
+TEST(Capacity, AppendRow) {
+  S21::Matrix matrix;
+  matrix.SetCols(3);
+  const double row[3] = {1, 2, 3};
+  for (int i = 0; i < 100; ++i) {
+    matrix.AppendRow(row);
+  }
+  ASSERT_TRUE(matrix.GetRows() == 100 && matrix.GetCols() == 3 &&
+              matrix.GetRowsCapacity() == 128 && matrix(99, 2) == 3);
+}
+
+TEST(Capacity, AppendRows) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(2, 4);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix matrix3;
+  matrix3.AppendRows(matrix1);
+  matrix3.AppendRows(matrix2);
+  matrix3.AppendRows(matrix3);
+  ASSERT_TRUE(matrix3.GetRows() == 10 && matrix3(4, 3) == matrix2(1, 3) &&
+              matrix3(5, 0) == matrix1(0, 0));
+}
+
+TEST(Capacity, AppendCol) {
+  S21::Matrix matrix(2, 1);
+  const double col[2] = {4, 5};
+  matrix.AppendCol(col);
+  matrix.AppendCol(col);
+  ASSERT_TRUE(matrix.GetCols() == 3 && matrix(1, 2) == 5 &&
+              matrix(0, 0) == 0);
+}
+
+TEST(Capacity, AppendWrongCols) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(3, 5);
+  ASSERT_THROW(matrix1.AppendRows(matrix2), std::out_of_range);
+}
+
 TEST(Constructors, Default) {
   S21::Matrix matrix;
   ASSERT_TRUE(matrix.GetRows() == 0 && matrix.GetCols() == 0 &&
@@ -343,6 +437,73 @@ TEST(Functions, Inverse) {
   ASSERT_TRUE(matrix1.InverseMatrix() == matrix2);
 }
 
+TEST(Functions, Solve) {
+  S21::Matrix matrix1(4, 4);
+  TestCase::fillMatrix(matrix1);
+  for (int i = 0; i < 4; ++i) {
+    matrix1(i, i) += 100;
+  }
+  S21::Matrix matrix2(4, 3);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix matrix3 = matrix1 * matrix2;
+  ASSERT_TRUE(matrix1.Solve(matrix3) == matrix2);
+  ASSERT_THROW(S21::Matrix(3, 3).Solve(S21::Matrix(3, 1)),
+               std::invalid_argument);
+  S21::Matrix matrix4(2, 2);
+  matrix4(0, 0) = matrix4(1, 0) = 1;
+  matrix4(0, 1) = 2;
+  matrix4(1, 1) = 2 + 1e-15;
+  ASSERT_THROW(matrix4.Solve(matrix4), std::invalid_argument);
+}
+
+TEST(Functions, Power) {
+  // Small integer entries keep every power exact, up to 3^25 at k = 13
+  S21::Matrix matrix1(3, 3);
+  srand(time(nullptr) + rand());
+  for (int i = 0; i < 3; ++i) {
+    for (int k = 0; k < 3; ++k) {
+      matrix1(i, k) = rand() % 4;
+    }
+  }
+  S21::Matrix matrix2(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    matrix2(i, i) = 1;
+  }
+  bool valCorrect = matrix1.Power(0) == matrix2;
+  for (int k = 1; k <= 13; ++k) {
+    matrix2 *= matrix1;
+    valCorrect = valCorrect && matrix1.Power(k) == matrix2;
+  }
+  for (int i = 0; i < 3; ++i) {
+    matrix1(i, i) += 10;
+  }
+  S21::Matrix matrix3 = matrix1.InverseMatrix();
+  ASSERT_TRUE(valCorrect && matrix1.Power(-2) == (matrix3 * matrix3));
+}
+
+TEST(Functions, Exp) {
+  S21::Matrix matrix1(2, 2);
+  matrix1(0, 1) = 1;
+  S21::Matrix matrix2(2, 2);
+  matrix2(0, 0) = matrix2(0, 1) = matrix2(1, 1) = 1;
+  S21::Matrix matrix3(3, 3);
+  matrix3(0, 0) = -2;
+  matrix3(1, 1) = 0.001;
+  matrix3(2, 2) = 4;
+  S21::Matrix matrix4 = matrix3.Exp();
+  S21::Matrix matrix5(2, 2);
+  matrix5(0, 1) = -10;
+  matrix5(1, 0) = 10;
+  S21::Matrix matrix6 = matrix5.Exp();
+  ASSERT_TRUE(matrix1.Exp() == matrix2 &&
+              fabs(matrix4(0, 0) - exp(-2)) <= 1e-12 &&
+              fabs(matrix4(1, 1) - exp(0.001)) <= 1e-12 &&
+              fabs(matrix4(2, 2) / exp(4) - 1) <= 1e-12 &&
+              matrix4(0, 2) == 0 &&
+              fabs(matrix6(0, 0) - cos(10)) <= 1e-10 &&
+              fabs(matrix6(1, 0) - sin(10)) <= 1e-10);
+}
+
 TEST(Operators, Equal) {
   S21::Matrix matrix1;
   TestCase::genMatrix(matrix1);
@@ -432,7 +593,7 @@ TEST(Operators, MulNumsIncrement) {
 
 TEST(Operators, MulMatrix) {
   S21::Matrix matrix1(3, 4);
-  S21::Matrix matrix2(3, 4);
+  S21::Matrix matrix2(4, 3);
   TestCase::fillMatrix(matrix1);
   TestCase::fillMatrix(matrix2);
   S21::Matrix matrix3(matrix1);
@@ -442,7 +603,7 @@ TEST(Operators, MulMatrix) {
 
 TEST(Operators, MulMatrixIncrement) {
   S21::Matrix matrix1(3, 4);
-  S21::Matrix matrix2(3, 4);
+  S21::Matrix matrix2(4, 3);
   TestCase::fillMatrix(matrix1);
   TestCase::fillMatrix(matrix2);
   S21::Matrix matrix3(matrix1);
@@ -450,7 +611,555 @@ TEST(Operators, MulMatrixIncrement) {
   ASSERT_TRUE(matrix3 == (matrix1 *= matrix2));
 }
 
+TEST(Chain, Evaluate) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(4, 2);
+  S21::Matrix matrix3(2, 5);
+  S21::Matrix matrix4(5, 3);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  TestCase::fillMatrix(matrix3);
+  TestCase::fillMatrix(matrix4);
+  S21::Matrix matrix5(matrix1);
+  matrix5.MulMatrix(matrix2);
+  matrix5.MulMatrix(matrix3);
+  matrix5.MulMatrix(matrix4);
+  S21::Matrix matrix6 = matrix1 * matrix2 * matrix3 * matrix4;
+  ASSERT_TRUE(matrix5 == matrix6);
+}
+
+TEST(Chain, OptimalOrder) {
+  S21::Matrix matrix1(10, 100);
+  S21::Matrix matrix2(100, 5);
+  S21::Matrix matrix3(5, 50);
+  ASSERT_TRUE((matrix1 * matrix2 * matrix3).GetCost() == 7500 &&
+              (matrix1 * (matrix2 * matrix3)).GetLength() == 3);
+}
+
+TEST(Chain, WrongSize) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(4, 2);
+  S21::Matrix matrix3(3, 5);
+  ASSERT_THROW(S21::Matrix(matrix1 * matrix2 * matrix3), std::out_of_range);
+  ASSERT_THROW(S21::Matrix(matrix1 * matrix3), std::out_of_range);
+  ASSERT_THROW(S21::Matrix(2, 3).MulMatrix(S21::Matrix(4, 2)),
+               std::out_of_range);
+}
+
+TEST(Chain, Temporaries) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(5, 4);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix matrix2T = matrix2.Transpose();
+  auto chain1 = matrix1 * matrix2.Transpose();
+  auto chain2 = matrix1.Transpose() * matrix1 * matrix2.Transpose();
+  S21::Matrix matrix3 = chain1;
+  S21::Matrix matrix4 = chain2;
+  S21::Matrix matrix5(matrix1);
+  matrix5.MulMatrix(matrix2T);
+  S21::Matrix matrix6 = matrix1.Transpose();
+  matrix6.MulMatrix(matrix1);
+  matrix6.MulMatrix(matrix2T);
+  ASSERT_TRUE(matrix3 == matrix5 && matrix4 == matrix6);
+}
+
+TEST(Chain, Interop) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(4, 2);
+  S21::Matrix matrix3(3, 2);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  TestCase::fillMatrix(matrix3);
+  S21::Matrix matrix4(matrix1);
+  matrix4.MulMatrix(matrix2);
+  S21::Matrix matrix5 = matrix1 * matrix2 + matrix3;
+  S21::Matrix matrix6 = matrix1 * matrix2 - matrix3;
+  ASSERT_TRUE(matrix5 == matrix4 + matrix3 && matrix6 == matrix4 - matrix3 &&
+              (matrix1 * matrix2) == matrix4 &&
+              (matrix1 * matrix2).Transpose() == matrix4.Transpose() &&
+              (matrix1 * matrix2)(2, 1) == matrix4(2, 1));
+}
+
+TEST(Chain, Forwarding) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(4, 3);
+  S21::Matrix matrix3(3, 2);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  TestCase::fillMatrix(matrix3);
+  for (int i = 0; i < 3; ++i) {
+    matrix1(i, i) += 100;
+    matrix2(i, i) += 100;
+  }
+  S21::Matrix matrix4(matrix1);
+  matrix4.MulMatrix(matrix2);
+  std::ostringstream out1, out2;
+  (matrix1 * matrix2).WriteMatrix(out1);
+  matrix4.WriteMatrix(out2);
+  ASSERT_TRUE((matrix1 * matrix2).GetRows() == 3 &&
+              (matrix1 * matrix2 * matrix3).GetCols() == 2 &&
+              (matrix1 * matrix2).EqMatrix(matrix4) &&
+              fabs((matrix1 * matrix2).Determinant() / matrix4.Determinant() -
+                   1) <= 1e-9 &&
+              (matrix1 * matrix2).CalcComplements() ==
+                  matrix4.CalcComplements() &&
+              (matrix1 * matrix2).InverseMatrix() == matrix4.InverseMatrix() &&
+              (matrix1 * matrix2).Solve(matrix3) == matrix4.Solve(matrix3) &&
+              (matrix1 * matrix2).Power(2) == matrix4.Power(2) &&
+              2 * (matrix1 * matrix2) == matrix4 * 2 &&
+              out1.str() == out2.str());
+}
+
+// Named factors are referenced, so the product is taken at evaluation time
+TEST(Chain, References) {
+  S21::Matrix matrix1(2, 2);
+  S21::Matrix matrix2(2, 2);
+  matrix1(0, 0) = 1;
+  matrix2(0, 0) = 3;
+  S21::Matrix matrix3 = matrix1 * matrix2;
+  auto chain = matrix1 * matrix2;
+  matrix1(0, 0) = 100;
+  ASSERT_TRUE(matrix3(0, 0) == 3 && S21::Matrix(chain)(0, 0) == 300);
+}
+
+TEST(Gemm, Transposes) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(4, 5);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix matrix1T = matrix1.Transpose();
+  S21::Matrix matrix2T = matrix2.Transpose();
+  S21::Matrix matrix3(3, 5);
+  TestCase::fillMatrix(matrix3);
+  S21::Matrix expected = 0.5 * (matrix1 * matrix2) + 2 * matrix3;
+  bool valCorrect = true;
+  for (int t = 0; t < 4; ++t) {
+    S21::Matrix matrix4(matrix3);
+    S21::Gemm(0.5, (t & 1) ? matrix1T : matrix1, t & 1,
+              (t & 2) ? matrix2T : matrix2, t & 2, 2, matrix4);
+    valCorrect = valCorrect && matrix4 == expected;
+  }
+  ASSERT_TRUE(valCorrect);
+}
+
+TEST(Gemm, Overwrite) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(4, 2);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix matrix3(7, 7);
+  S21::Gemm(1, matrix1, false, matrix2, false, 0, matrix3);
+  ASSERT_TRUE(matrix3 == (matrix1 * matrix2));
+}
+
+TEST(Gemm, WrongSize) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(3, 4);
+  S21::Matrix matrix3(3, 4);
+  ASSERT_THROW(S21::Gemm(1, matrix1, false, matrix2, false, 1, matrix3),
+               std::out_of_range);
+  ASSERT_THROW(S21::Gemm(1, matrix1, false, matrix1, true, 1, matrix1),
+               std::invalid_argument);
+}
+
+TEST(Gemm, Gemv) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix vector1(4, 1);
+  S21::Matrix vector2(3, 1);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(vector1);
+  TestCase::fillMatrix(vector2);
+  S21::Matrix expected = 3 * (matrix1 * vector1) - vector2;
+  S21::Matrix vector3(vector2);
+  S21::Gemv(3, matrix1, false, vector1, -1, vector3);
+  S21::Matrix matrix1T = matrix1.Transpose();
+  S21::Gemv(3, matrix1T, true, vector1, -1, vector2);
+  ASSERT_TRUE(vector3 == expected && vector2 == expected);
+}
+
+TEST(Gemm, Axpy) {
+  S21::Matrix matrix1(3, 4);
+  S21::Matrix matrix2(3, 4);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix expected = matrix2 + 2 * matrix1;
+  S21::Axpy(2, matrix1, matrix2);
+  ASSERT_TRUE(matrix2 == expected);
+}
+
+TEST(Structured, Diagonal) {
+  S21::DiagonalMatrix diag(3);
+  diag(0, 0) = 2;
+  diag(1, 1) = -4;
+  diag(2, 2) = 0.5;
+  S21::Matrix matrix1(3, 4);
+  TestCase::fillMatrix(matrix1);
+  S21::Matrix dense = diag.ToMatrix();
+  ASSERT_TRUE(diag.Determinant() == -4 &&
+              diag * matrix1 == (dense * matrix1) &&
+              diag.Solve(diag * matrix1) == matrix1);
+  ASSERT_THROW(diag(0, 1), std::out_of_range);
+}
+
+TEST(Structured, Triangular) {
+  bool valCorrect = true;
+  for (int upper = 0; upper < 2; ++upper) {
+    S21::TriangularMatrix tri(4, upper);
+    srand(time(nullptr) + rand());
+    for (int i = 0; i < 4; ++i) {
+      for (int k = upper ? i : 0; k < (upper ? 4 : i + 1); ++k) {
+        tri(i, k) = rand() % 24 + ((i == k) ? 1 : 0);
+      }
+    }
+    S21::Matrix dense = tri.ToMatrix();
+    S21::Matrix matrix1(4, 3);
+    TestCase::fillMatrix(matrix1);
+    valCorrect = valCorrect && tri.Determinant() == dense.Determinant() &&
+                 tri * matrix1 == (dense * matrix1) &&
+                 tri.Solve(tri * matrix1) == matrix1 &&
+                 tri.InverseMatrix().ToMatrix() == dense.InverseMatrix();
+  }
+  ASSERT_TRUE(valCorrect);
+}
+
+TEST(Structured, Symmetric) {
+  S21::SymmetricMatrix sym(4);
+  srand(time(nullptr) + rand());
+  for (int i = 0; i < 4; ++i) {
+    for (int k = 0; k <= i; ++k) {
+      sym(i, k) = rand() % 24 + ((i == k) ? 100 : 0);
+    }
+  }
+  sym(0, 3) = 7;
+  S21::Matrix dense = sym.ToMatrix();
+  S21::Matrix matrix1(4, 2);
+  TestCase::fillMatrix(matrix1);
+  ASSERT_TRUE(sym.Get(3, 0) == 7 &&
+              fabs(sym.Determinant() - dense.Determinant()) <= 1e-3 &&
+              sym * matrix1 == (dense * matrix1) &&
+              sym.Solve(sym * matrix1) == matrix1 &&
+              sym.InverseMatrix().ToMatrix() == dense.InverseMatrix());
+}
+
+TEST(Structured, SymmetricZeroPivot) {
+  S21::SymmetricMatrix sym(2);
+  sym(1, 0) = 1;
+  S21::Matrix matrix1(2, 1);
+  matrix1(0, 0) = 3;
+  matrix1(1, 0) = 5;
+  S21::Matrix matrix2 = sym.Solve(matrix1);
+  ASSERT_TRUE(sym.Determinant() == -1 && matrix2(0, 0) == 5 &&
+              matrix2(1, 0) == 3);
+}
+
+TEST(Structured, SymmetricZeroPivotLarge) {
+  const int size = 40;
+  S21::SymmetricMatrix sym(size);
+  for (int i = 1; i < size; ++i) {
+    sym(i, i) = 2;
+    sym(i, i - 1) = 1;
+  }
+  S21::Matrix matrix1(size, 2);
+  TestCase::fillMatrix(matrix1);
+  ASSERT_TRUE(fabs(sym.Determinant() + (size - 1)) <= 1e-7 &&
+              sym * sym.Solve(matrix1) == matrix1);
+}
+
+TEST(Structured, SymmetricIndefinite) {
+  S21::SymmetricMatrix sym(2);
+  sym(0, 0) = 1e-18;
+  sym(1, 0) = 1;
+  sym(1, 1) = 1;
+  S21::Matrix matrix1(2, 1);
+  matrix1(0, 0) = 1;
+  matrix1(1, 0) = 2;
+  S21::Matrix matrix2 = sym.Solve(matrix1);
+  ASSERT_TRUE(fabs(matrix2(0, 0) - 1) <= 1e-12 &&
+              fabs(matrix2(1, 0) - 1) <= 1e-12);
+  S21::SymmetricMatrix sym2(8);
+  for (int i = 0; i < 8; ++i) {
+    for (int k = 0; k < i; ++k) {
+      sym2(i, k) = (i * 7 + k * 3) % 11 - 5;
+    }
+  }
+  S21::Matrix dense = sym2.ToMatrix();
+  S21::Matrix matrix3(8, 3);
+  TestCase::fillMatrix(matrix3);
+  ASSERT_TRUE(fabs(sym2.Determinant() / dense.Determinant() - 1) <= 1e-9 &&
+              sym2 * sym2.Solve(matrix3) == matrix3);
+  S21::SymmetricMatrix singular(2);
+  singular(0, 0) = singular(1, 0) = singular(1, 1) = 1;
+  ASSERT_TRUE(singular.Determinant() == 0);
+  ASSERT_THROW(singular.Solve(matrix1), std::invalid_argument);
+}
+
+TEST(Structured, InverseSmallDeterminant) {
+  S21::SymmetricMatrix sym(30);
+  S21::BandedMatrix band(30, 1, 1);
+  for (int i = 0; i < 30; ++i) {
+    sym(i, i) = band(i, i) = 0.5;
+  }
+  S21::SymmetricMatrix symInverse = sym.InverseMatrix();
+  S21::Matrix bandInverse = band.InverseMatrix();
+  ASSERT_TRUE(symInverse.Get(29, 29) == 2 && symInverse.Get(29, 0) == 0 &&
+              bandInverse(29, 29) == 2 && bandInverse(0, 29) == 0);
+}
+
+TEST(Structured, BandedZeroPivot) {
+  S21::BandedMatrix band(5, 2, 1);
+  srand(time(nullptr) + rand());
+  for (int i = 0; i < 5; ++i) {
+    for (int k = std::max(0, i - 2); k < 5 && k <= i + 1; ++k) {
+      band(i, k) = rand() % 24 + 1;
+    }
+  }
+  band(0, 0) = 0;
+  band(2, 2) = 0;
+  S21::Matrix dense = band.ToMatrix();
+  S21::Matrix matrix1(5, 3);
+  TestCase::fillMatrix(matrix1);
+  ASSERT_TRUE(fabs(band.Determinant() - dense.Determinant()) <= 1e-6 &&
+              band.Solve(band * matrix1) == matrix1);
+  S21::BandedMatrix singular(3, 1, 1);
+  singular(0, 1) = 1;
+  singular(1, 0) = 1;
+  ASSERT_TRUE(singular.Determinant() == 0);
+  ASSERT_THROW(singular.Solve(S21::Matrix(3, 1)), std::invalid_argument);
+}
+
+TEST(Structured, Banded) {
+  S21::BandedMatrix band(5, 1, 2);
+  srand(time(nullptr) + rand());
+  for (int i = 0; i < 5; ++i) {
+    for (int k = std::max(0, i - 1); k < 5 && k <= i + 2; ++k) {
+      band(i, k) = rand() % 24 + ((i == k) ? 100 : 0);
+    }
+  }
+  S21::Matrix dense = band.ToMatrix();
+  S21::Matrix matrix1(5, 3);
+  TestCase::fillMatrix(matrix1);
+  ASSERT_TRUE(fabs(band.Determinant() / dense.Determinant() - 1) <= 1e-9 &&
+              band * matrix1 == (dense * matrix1) &&
+              band.Solve(band * matrix1) == matrix1 &&
+              band.InverseMatrix() == dense.InverseMatrix());
+  ASSERT_THROW(band(0, 3), std::out_of_range);
+}
+
+TEST(Shared, Attach) {
+  const std::string name = "/s21_matrix_test_" + std::to_string(getpid());
+  S21::Matrix matrix1(3, 4, name);
+  TestCase::fillMatrix(matrix1);
+  S21::Matrix matrix2(3, 4, name);
+  S21::Matrix::UnlinkShared(name);
+  matrix2(2, 3) = -1;
+  ASSERT_TRUE(matrix1.IsShared() && matrix1 == matrix2 &&
+              matrix1(2, 3) == -1);
+  ASSERT_THROW(matrix1.SetRows(4), std::out_of_range);
+}
+
+TEST(Shared, MulMatrix) {
+  S21::Matrix matrix1(37, 21);
+  S21::Matrix matrix2(21, 45);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix matrix3(matrix1);
+  matrix3.MulMatrix(matrix2);
+  bool valCorrect = true;
+  for (int processes = 1; processes <= 3; ++processes) {
+    S21::Matrix matrix4(matrix1);
+    valCorrect = valCorrect &&
+                 matrix4.MulMatrixShared(matrix2, processes, 8) == processes &&
+                 matrix4 == matrix3 && !matrix4.IsShared();
+  }
+  ASSERT_TRUE(valCorrect);
+}
+
+TEST(Shared, Worker) {
+  const std::string name = "/s21_matrix_job_" + std::to_string(getpid());
+  S21::Matrix matrix1(200, 150);
+  S21::Matrix matrix2(150, 200);
+  TestCase::fillMatrix(matrix1);
+  TestCase::fillMatrix(matrix2);
+  S21::Matrix matrix3(matrix1);
+  matrix3.MulMatrix(matrix2);
+  const pid_t pid = fork();
+  if (pid == 0) {
+    for (int attempt = 0; attempt < 10000; ++attempt) {
+      try {
+        S21::Matrix::MulMatrixWorker(name);
+        _exit(0);
+      } catch (const std::runtime_error &) {
+        usleep(100);
+      }
+    }
+    _exit(0);
+  }
+  usleep(1000);
+  matrix1.MulMatrixShared(matrix2, name, 8);
+  int status = 0;
+  ASSERT_TRUE(waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+              WEXITSTATUS(status) == 0 && matrix1 == matrix3);
+  ASSERT_THROW(S21::Matrix::MulMatrixWorker(name), std::runtime_error);
+  S21::Matrix matrix4(2, 2, name);
+  ASSERT_THROW(S21::Matrix(200, 150).MulMatrixShared(matrix2, name),
+               std::runtime_error);
+  S21::Matrix::UnlinkShared(name);
+}
+
+TEST(Tracker, RankOneUpdate) {
+  S21::Matrix matrix1(4, 4);
+  TestCase::fillMatrix(matrix1);
+  for (int i = 0; i < 4; ++i) {
+    matrix1(i, i) += 100;
+  }
+  S21::InverseTracker tracker(matrix1);
+  S21::Matrix vector1(4, 1);
+  S21::Matrix vector2(4, 1);
+  TestCase::fillMatrix(vector1);
+  TestCase::fillMatrix(vector2);
+  vector2.MulNumber(0.1);
+  tracker.RankOneUpdate(vector1, vector2);
+  S21::Matrix matrix2 = matrix1 + (vector1 * vector2.Transpose());
+  const double det = matrix2.Determinant();
+  ASSERT_TRUE(tracker.GetMatrix() == matrix2 &&
+              tracker.GetInverse() == matrix2.InverseMatrix() &&
+              fabs(tracker.GetDeterminant() / det - 1) <= 1e-9 &&
+              tracker.GetUpdates() == 1);
+}
+
+TEST(Tracker, RankUpdate) {
+  S21::Matrix matrix1(5, 5);
+  TestCase::fillMatrix(matrix1);
+  for (int i = 0; i < 5; ++i) {
+    matrix1(i, i) += 100;
+  }
+  S21::InverseTracker tracker(matrix1, 3);
+  S21::Matrix matrix2(matrix1);
+  bool valCorrect = true;
+  for (int step = 0; step < 5; ++step) {
+    S21::Matrix matrix3(5, 2);
+    S21::Matrix matrix4(5, 2);
+    TestCase::fillMatrix(matrix3);
+    TestCase::fillMatrix(matrix4);
+    matrix4.MulNumber(0.05);
+    tracker.RankUpdate(matrix3, matrix4);
+    matrix2 += (matrix3 * matrix4.Transpose());
+    valCorrect =
+        valCorrect && tracker.GetInverse() == matrix2.InverseMatrix() &&
+        fabs(tracker.GetDeterminant() / matrix2.Determinant() - 1) <= 1e-9;
+  }
+  ASSERT_TRUE(valCorrect && tracker.GetUpdates() == 2);
+}
+
+TEST(Tracker, Singular) {
+  S21::Matrix matrix1(3, 3);
+  ASSERT_THROW(S21::InverseTracker tracker(matrix1), std::invalid_argument);
+}
+
+TEST(Tracker, SingularUpdate) {
+  S21::Matrix matrix1(2, 2);
+  matrix1(0, 0) = 2;
+  matrix1(1, 1) = 4;
+  S21::Matrix vector1(2, 1);
+  S21::Matrix vector2(2, 1);
+  vector1(0, 0) = -2;
+  vector2(0, 0) = 1;
+  bool valCorrect = true;
+  for (int refactorEvery = 1; refactorEvery <= 2; ++refactorEvery) {
+    S21::InverseTracker tracker(matrix1, refactorEvery);
+    const S21::Matrix inverse = tracker.GetInverse();
+    ASSERT_THROW(tracker.RankOneUpdate(vector1, vector2),
+                 std::invalid_argument);
+    valCorrect = valCorrect && tracker.GetMatrix() == matrix1 &&
+                 tracker.GetInverse() == inverse &&
+                 tracker.GetDeterminant() == 8 && tracker.GetUpdates() == 0;
+  }
+  ASSERT_TRUE(valCorrect);
+}
+
+TEST(Tracker, TinyUpdates) {
+  S21::Matrix matrix1(2, 2);
+  matrix1(0, 0) = matrix1(1, 1) = 1;
+  S21::InverseTracker tracker(matrix1, 1000);
+  S21::Matrix vector1(2, 1);
+  S21::Matrix vector2(2, 1);
+  vector1(0, 0) = 1e-8;
+  vector2(1, 0) = 1;
+  for (int step = 0; step < 100; ++step) {
+    tracker.RankOneUpdate(vector1, vector2);
+  }
+  ASSERT_TRUE(fabs(tracker.GetMatrix()(0, 1) - 1e-6) <= 1e-15 &&
+              fabs(tracker.GetInverse()(0, 1) + 1e-6) <= 1e-15);
+  tracker.Refactorize();
+  ASSERT_TRUE(fabs(tracker.GetInverse()(0, 1) + 1e-6) <= 1e-15);
+}
+
+TEST(Tracker, SmallEntries) {
+  S21::Matrix matrix1(5, 5);
+  for (int i = 0; i < 5; ++i) {
+    for (int k = 0; k < 5; ++k) {
+      matrix1(i, k) = (i == k) ? 2e-3 : 5e-4;
+    }
+  }
+  S21::InverseTracker tracker(matrix1);
+  S21::Matrix matrix2 = tracker.GetInverse() * matrix1;
+  bool valCorrect = true;
+  for (int i = 0; i < 5; ++i) {
+    for (int k = 0; k < 5; ++k) {
+      valCorrect = valCorrect && fabs(matrix2(i, k) - (i == k)) <= 1e-12;
+    }
+  }
+  ASSERT_TRUE(valCorrect && tracker.GetDeterminant() > 0 &&
+              tracker.GetDeterminant() < 1e-12);
+}
+
+TEST(TextIO, Read) {
+  std::istringstream in("1, 2.5,-3\r\n\n  4e2\t5 +6\n7;8;9");
+  S21::Matrix matrix1 = S21::Matrix::ReadMatrix(in);
+  ASSERT_TRUE(matrix1.GetRows() == 3 && matrix1.GetCols() == 3 &&
+              matrix1(0, 1) == 2.5 && matrix1(1, 0) == 400 &&
+              matrix1(1, 2) == 6 && matrix1(2, 2) == 9);
+}
+
+TEST(TextIO, RoundTrip) {
+  S21::Matrix matrix1(9000, 3);
+  TestCase::fillMatrix(matrix1);
+  matrix1(0, 0) = 0.1;
+  matrix1(8999, 2) = -1.0 / 3;
+  std::stringstream stream;
+  matrix1.WriteMatrix(stream, ' ');
+  S21::Matrix matrix2 = S21::Matrix::ReadMatrix(stream, 4);
+  ASSERT_TRUE(matrix2 == matrix1 && matrix2(0, 0) == 0.1 &&
+              matrix2(8999, 2) == -1.0 / 3);
+}
+
+TEST(TextIO, Malformed) {
+  std::istringstream in1("1,2\n3\n");
+  std::istringstream in2("1,2\n3,4,5\n");
+  std::istringstream in3("1,2\n3,x\n");
+  ASSERT_THROW(S21::Matrix::ReadMatrix(in1), std::invalid_argument);
+  ASSERT_THROW(S21::Matrix::ReadMatrix(in2), std::invalid_argument);
+  ASSERT_THROW(S21::Matrix::ReadMatrix(in3), std::invalid_argument);
+  std::istringstream in4("1,+-2\n");
+  std::ostringstream out;
+  ASSERT_THROW(S21::Matrix::ReadMatrix(in4), std::invalid_argument);
+  ASSERT_THROW(S21::Matrix(1, 1).WriteMatrix(out, '|'), std::invalid_argument);
+  ASSERT_THROW(S21::Matrix(1, 1).SaveMatrix("/nonexistent/m.csv", '|'),
+               std::invalid_argument);
+}
+
+TEST(TextIO, LongLine) {
+  S21::Matrix matrix1(2, 300000);
+  TestCase::fillMatrix(matrix1);
+  matrix1.MulNumber(1.0 / 3);
+  std::stringstream stream;
+  matrix1.WriteMatrix(stream, ';');
+  ASSERT_TRUE(stream.str().size() > (1u << 22) &&
+              S21::Matrix::ReadMatrix(stream) == matrix1);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}